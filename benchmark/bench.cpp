@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <iterable/numa.h>
+#include <iterable/parallel.h>
+#include "containers.h"
+
+namespace {
+
+constexpr std::size_t MinLength = 1 << 10;
+constexpr std::size_t MaxLength = 1 << 22;
+
+// Elements of the NUMA scans, large enough to exceed the last-level caches
+constexpr std::size_t NumaLength = 1 << 26;
+
+// Fills the container with a reproducible permutation of [0, length)
+template <typename C>
+C MakeShuffled(std::size_t length) {
+  auto container = Bench::Make<C>(length);
+  std::iota(container.begin(), container.end(), 0);
+  std::shuffle(container.begin(), container.end(), std::mt19937(42));
+  return container;
+}
+
+// Reports the elements processed over all iterations
+void SetItems(benchmark::State &state) {
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <typename C>
+void RangeForSum(benchmark::State &state) {
+  const auto container = MakeShuffled<C>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    int sum = 0;
+    for (int value : container) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void Accumulate(benchmark::State &state) {
+  const auto container = MakeShuffled<C>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::accumulate(container.begin(), container.end(), 0));
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void Find(benchmark::State &state) {
+  const auto container = MakeShuffled<C>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::find(container.begin(), container.end(), -1));
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void Copy(benchmark::State &state) {
+  const auto container = MakeShuffled<C>(static_cast<std::size_t>(state.range(0)));
+  std::vector<int> output(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::copy(container.begin(), container.end(), output.begin());
+    benchmark::ClobberMemory();
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void Sort(benchmark::State &state) {
+  const auto source = MakeShuffled<Bench::Vector>(static_cast<std::size_t>(state.range(0)));
+  auto container = Bench::Make<C>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(source.begin(), source.end(), container.begin());
+    state.ResumeTiming();
+    std::sort(container.begin(), container.end());
+    benchmark::ClobberMemory();
+  }
+  SetItems(state);
+}
+
+// Scaling of the parallel entry points: range(0) is the length, range(1) the thread count
+template <typename C>
+void ParallelSortScaling(benchmark::State &state) {
+  Iterable::ThreadPool pool(static_cast<unsigned>(state.range(1)));
+  const auto source = MakeShuffled<Bench::Vector>(static_cast<std::size_t>(state.range(0)));
+  auto container = Bench::Make<C>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(source.begin(), source.end(), container.begin());
+    state.ResumeTiming();
+    Iterable::ParallelSort(container, std::less<>(), pool);
+    benchmark::ClobberMemory();
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void ParallelReduceScaling(benchmark::State &state) {
+  Iterable::ThreadPool pool(static_cast<unsigned>(state.range(1)));
+  const auto container = MakeShuffled<C>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Iterable::ParallelReduce(container, std::int64_t(0), std::plus<>(), pool));
+  }
+  SetItems(state);
+}
+
+// Scan over memory first touched by the node that scans it: range(0) is the
+// length, range(1) the thread count
+void NumaForScaling(benchmark::State &state) {
+  auto length = static_cast<std::size_t>(state.range(0));
+  Iterable::NumaPool pool(Iterable::Topology::Detect(), static_cast<unsigned>(state.range(1)));
+  std::unique_ptr<int[]> data(new int[length]);
+  Iterable::FirstTouch(data.get(), data.get() + length, [](int &value) { value = 1; }, pool);
+  for (auto _ : state) {
+    Iterable::NumaFor(data.get(), data.get() + length, [](int &value) { value = value * 3 + 1; }, 0, pool);
+    benchmark::ClobberMemory();
+  }
+  state.counters["nodes"] = pool.NodeCount();
+  state.counters["pinned"] = pool.Pinned();
+  SetItems(state);
+}
+
+// The same scan over memory written by the main thread, so on several nodes
+void ParallelForScaling(benchmark::State &state) {
+  auto length = static_cast<std::size_t>(state.range(0));
+  Iterable::ThreadPool pool(static_cast<unsigned>(state.range(1)));
+  std::unique_ptr<int[]> data(new int[length]);
+  std::fill(data.get(), data.get() + length, 1);
+  for (auto _ : state) {
+    Iterable::ParallelFor(data.get(), data.get() + length, [](int &value) { value = value * 3 + 1; }, 0, pool);
+    benchmark::ClobberMemory();
+  }
+  SetItems(state);
+}
+
+} // namespace
+
+#define ITERABLE_BENCH(Name)                                                        \
+  BENCHMARK_TEMPLATE(Name, Bench::Indexed)->Range(MinLength, MaxLength);           \
+  BENCHMARK_TEMPLATE(Name, Bench::Contiguous)->Range(MinLength, MaxLength);        \
+  BENCHMARK_TEMPLATE(Name, Bench::Pointer)->Range(MinLength, MaxLength);           \
+  BENCHMARK_TEMPLATE(Name, Bench::Passthrough)->Range(MinLength, MaxLength);       \
+  BENCHMARK_TEMPLATE(Name, Bench::Raw)->Range(MinLength, MaxLength);               \
+  BENCHMARK_TEMPLATE(Name, Bench::Vector)->Range(MinLength, MaxLength)
+
+ITERABLE_BENCH(RangeForSum);
+ITERABLE_BENCH(Accumulate);
+ITERABLE_BENCH(Find);
+ITERABLE_BENCH(Copy);
+ITERABLE_BENCH(Sort);
+
+#define ITERABLE_SCALING_BENCH(Name)                                                              \
+  BENCHMARK_TEMPLATE(Name, Bench::Indexed)->ArgsProduct({{MaxLength}, {1, 2, 4, 8}})->UseRealTime(); \
+  BENCHMARK_TEMPLATE(Name, Bench::Pointer)->ArgsProduct({{MaxLength}, {1, 2, 4, 8}})->UseRealTime()
+
+ITERABLE_SCALING_BENCH(ParallelSortScaling);
+ITERABLE_SCALING_BENCH(ParallelReduceScaling);
+
+BENCHMARK(NumaForScaling)->ArgsProduct({{NumaLength}, {1, 2, 4, 8, 16, 32}})->UseRealTime();
+BENCHMARK(ParallelForScaling)->ArgsProduct({{NumaLength}, {1, 2, 4, 8, 16, 32}})->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+# Fails if a kernel in SOURCE marked ITERABLE_SAME_AS <Reference> compiles to
+# different instructions than its reference function in ASSEMBLY.
+#
+#   cmake -DSOURCE=<parity.cpp> -DASSEMBLY=<file.s> -P check_parity.cmake
+#
+# Functions are compared by the sorted list of their instruction mnemonics,
+# so register allocation, label names, operand order and block layout may
+# differ, but an extra load, call, bounds check or a lost vectorization does
+# not go unnoticed. Kernels must be extern "C" so that labels are their names.
+cmake_minimum_required(VERSION 3.23)
+
+if(NOT EXISTS ${ASSEMBLY})
+  message(FATAL_ERROR "No assembly at ${ASSEMBLY}")
+endif()
+get_filename_component(source_name ${SOURCE} NAME)
+
+# Kernel and reference names from the markers
+file(STRINGS ${SOURCE} markers REGEX "// ITERABLE_SAME_AS ")
+set(pairs)
+foreach(line IN LISTS markers)
+  if(line MATCHES "([A-Za-z_][A-Za-z0-9_]*)\\(.*// ITERABLE_SAME_AS ([A-Za-z_][A-Za-z0-9_]*)")
+    list(APPEND pairs "${CMAKE_MATCH_1}=${CMAKE_MATCH_2}")
+  endif()
+endforeach()
+if(NOT pairs)
+  message(FATAL_ERROR "No ITERABLE_SAME_AS markers in ${source_name}")
+endif()
+
+# Mnemonics of every function, stored in variables named mnemonics_<function>
+file(READ ${ASSEMBLY} content)
+string(REPLACE ";" "," content "${content}")
+string(REPLACE "\n" ";" lines "${content}")
+set(function)
+set(functions)
+foreach(line IN LISTS lines)
+  if(line MATCHES "^_?([A-Za-z_][A-Za-z0-9_]*):")
+    set(function ${CMAKE_MATCH_1})
+    list(APPEND functions ${function})
+    set(mnemonics_${function})
+  elseif(function AND line MATCHES "^[ \t]+\\.cfi_endproc")
+    set(function)
+  elseif(function AND line MATCHES "^[ \t]+([a-z][a-z0-9.]*)")
+    list(APPEND mnemonics_${function} ${CMAKE_MATCH_1})
+  endif()
+endforeach()
+
+set(failed)
+foreach(pair IN LISTS pairs)
+  string(REPLACE "=" ";" pair "${pair}")
+  list(GET pair 0 kernel)
+  list(GET pair 1 reference)
+  foreach(name IN ITEMS ${kernel} ${reference})
+    if(NOT name IN_LIST functions)
+      message(FATAL_ERROR "Function ${name} not found in ${ASSEMBLY}")
+    endif()
+  endforeach()
+  set(actual ${mnemonics_${kernel}})
+  set(expected ${mnemonics_${reference}})
+  list(SORT actual)
+  list(SORT expected)
+  if(NOT actual STREQUAL expected)
+    list(LENGTH mnemonics_${kernel} actual_count)
+    list(LENGTH mnemonics_${reference} expected_count)
+    message(STATUS "${kernel}: ${actual_count} instructions, ${reference}: ${expected_count}")
+    list(APPEND failed ${kernel})
+  endif()
+endforeach()
+
+if(failed)
+  string(REPLACE ";" ", " failed "${failed}")
+  message(FATAL_ERROR "Kernels differing from their reference loop: ${failed}")
+endif()
+list(LENGTH pairs count)
+message(STATUS "All ${count} kernels in ${source_name} match their reference loops")
@@ -0,0 +1,71 @@
+# Fails if a kernel in SOURCE marked ITERABLE_VECTORIZED has no vectorized
+# loop in the compiler's optimization remarks.
+#
+#   cmake -DSOURCE=<codegen.cpp> -DREMARKS=<file> -DFORMAT=<gcc|clang> -P check_vectorized.cmake
+#
+# FORMAT gcc reads -fopt-info-vec-all output, clang reads the YAML written by
+# -fsave-optimization-record.
+cmake_minimum_required(VERSION 3.23)
+
+if(NOT EXISTS ${REMARKS})
+  message(FATAL_ERROR "No optimization remarks at ${REMARKS}")
+endif()
+get_filename_component(source_name ${SOURCE} NAME)
+
+# Source lines reported as vectorized
+set(vectorized)
+file(READ ${REMARKS} content)
+string(REPLACE ";" "," content "${content}")
+if(FORMAT STREQUAL "gcc")
+  string(REPLACE "\n" ";" records "${content}")
+  foreach(record IN LISTS records)
+    if(record MATCHES "${source_name}:([0-9]+):[0-9]+: .*(loop vectorized|vectorized [1-9][0-9]* loops)")
+      list(APPEND vectorized ${CMAKE_MATCH_1})
+    endif()
+  endforeach()
+elseif(FORMAT STREQUAL "clang")
+  string(REPLACE "--- !" ";" records "${content}")
+  foreach(record IN LISTS records)
+    if(record MATCHES "Name:[ ]+Vectorized" AND
+       record MATCHES "File:[ ]+'?[^,']*${source_name}'?,[ \n]+Line:[ ]+([0-9]+)")
+      list(APPEND vectorized ${CMAKE_MATCH_1})
+    endif()
+  endforeach()
+else()
+  message(FATAL_ERROR "Unknown remark format '${FORMAT}'")
+endif()
+
+# Kernels span from their marker line to the next blank line
+file(READ ${SOURCE} content)
+string(REPLACE ";" "," content "${content}")
+string(REPLACE "\n" ";" lines "${content}")
+set(number 0)
+set(kernel)
+set(failed)
+foreach(line IN LISTS lines)
+  math(EXPR number "${number} + 1")
+  if(line MATCHES "^([A-Za-z_].*[ *&])?([A-Za-z_][A-Za-z0-9_]*)\\(.*// ITERABLE_VECTORIZED")
+    set(kernel ${CMAKE_MATCH_2})
+    set(found FALSE)
+  endif()
+  if(kernel)
+    if(number IN_LIST vectorized)
+      set(found TRUE)
+    endif()
+    if(line STREQUAL "")
+      if(NOT found)
+        list(APPEND failed ${kernel})
+      endif()
+      set(kernel)
+    endif()
+  endif()
+endforeach()
+if(kernel AND NOT found)
+  list(APPEND failed ${kernel})
+endif()
+
+if(failed)
+  string(REPLACE ";" ", " failed "${failed}")
+  message(FATAL_ERROR "Loops not vectorized in: ${failed}")
+endif()
+message(STATUS "All marked loops in ${source_name} vectorized")
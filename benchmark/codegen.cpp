@@ -0,0 +1,50 @@
+// Kernels whose loops must be vectorized. Each kernel starts on a line
+// marked ITERABLE_VECTORIZED and ends at the next blank line; the
+// check_vectorized.cmake script fails the build if the compiler reports no
+// vectorized loop within that span.
+#include <algorithm>
+#include "containers.h"
+
+int SumIndexed(const Bench::Indexed &container) { // ITERABLE_VECTORIZED
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumContiguous(const Bench::Contiguous &container) { // ITERABLE_VECTORIZED
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumPointer(const Bench::Pointer &container) { // ITERABLE_VECTORIZED
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumPassthrough(const Bench::Passthrough &container) { // ITERABLE_VECTORIZED
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+void ScaleIndexed(Bench::Indexed &container) { // ITERABLE_VECTORIZED
+  for (int &value : container) {
+    value *= 3;
+  }
+}
+
+void ScalePointer(Bench::Pointer &container) { // ITERABLE_VECTORIZED
+  for (int &value : container) {
+    value *= 3;
+  }
+}
@@ -0,0 +1,78 @@
+/**
+ * @file
+ * @brief Container types shared by the benchmarks and codegen checks.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <iterable/iterable.h>
+
+namespace Bench {
+/// Index iteration through `Iterator<D, Default>`
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+/// Index iteration through `Iterator<D, Contiguous>` (no `Data()`)
+struct Contiguous : Iterable::For<Contiguous, Iterable::Contiguous> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+/// Pointer iteration through `Data()` with `Tag::Contiguous`
+struct Pointer : Iterable::For<Pointer, Iterable::Contiguous> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+  int *Data() { return values.data(); }
+  const int *Data() const { return values.data(); }
+};
+
+/// Forwarding to the public `data_` member
+struct Passthrough : Iterable::For<Passthrough> {
+  std::vector<int> data_;
+};
+
+/// Plain heap array iterated by raw pointers
+struct Raw {
+  std::unique_ptr<int[]> values;
+  std::size_t length = 0;
+
+  int *begin() { return values.get(); }
+  int *end() { return values.get() + length; }
+  const int *begin() const { return values.get(); }
+  const int *end() const { return values.get() + length; }
+};
+
+/// Standard vector for reference
+using Vector = std::vector<int>;
+
+/// Creates a container of `length` zero-initialized elements
+template <typename C>
+C Make(std::size_t length) {
+  if constexpr (std::is_same_v<C, Vector>) {
+    return Vector(length);
+  } else if constexpr (std::is_same_v<C, Raw>) {
+    return Raw{std::make_unique<int[]>(length), length};
+  } else if constexpr (std::is_same_v<C, Passthrough>) {
+    C container;
+    container.data_.resize(length);
+    return container;
+  } else {
+    C container;
+    container.values.resize(length);
+    return container;
+  }
+}
+} // namespace Bench
@@ -0,0 +1,93 @@
+// Translation unit instantiating the iteration surface of `For` and
+// `Iterator` for ITERABLE_TYPES distinct container types of each tag, used
+// by measure_instantiation.cmake to track compile time and the number of
+// template functions emitted per type. With ITERABLE_BASELINE, the same
+// loops run over plain structs, which gives the cost of the loops alone.
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#ifndef ITERABLE_TYPES
+#define ITERABLE_TYPES 64
+#endif
+
+#if ITERABLE_BASELINE
+namespace {
+template <int K, int Kind>
+struct Plain {
+  std::vector<int> values;
+
+  int *begin() { return values.data(); }
+  int *end() { return values.data() + values.size(); }
+};
+
+template <int K>
+using Indexed = Plain<K, 0>;
+template <int K>
+using Pointer = Plain<K, 1>;
+template <int K>
+using Proxy = Plain<K, 2>;
+} // namespace
+#else
+#include <iterable/iterable.h>
+
+namespace {
+template <int K>
+struct Indexed : Iterable::For<Indexed<K>> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+template <int K>
+struct Pointer : Iterable::For<Pointer<K>, Iterable::Contiguous> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+  int *Data() { return values.data(); }
+};
+
+template <int K>
+struct Proxy : Iterable::For<Proxy<K>, Iterable::Proxy> {
+  std::vector<int> values;
+
+  int operator[](std::size_t index) const { return values[index] + K; }
+  std::size_t Length() const { return values.size(); }
+};
+} // namespace
+#endif
+
+// Typical uses of a container: a range-based for loop, an iterator loop with
+// arithmetic and a backward loop
+template <typename C>
+int Use(C &container) {
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  auto first = container.begin();
+  auto last = container.end();
+  for (auto it = first; it != last; ++it) {
+    sum += *it;
+  }
+  for (auto it = last; it != first;) {
+    sum -= *--it;
+  }
+  return sum + static_cast<int>(last - first);
+}
+
+template <int... K>
+int UseAll(std::integer_sequence<int, K...>) {
+  std::tuple<Indexed<K>...> indexed;
+  std::tuple<Pointer<K>...> pointer;
+  std::tuple<Proxy<K>...> proxy;
+  return (0 + ... + (Use(std::get<K>(indexed)) + Use(std::get<K>(pointer)) + Use(std::get<K>(proxy))));
+}
+
+int Instantiate() {
+  return UseAll(std::make_integer_sequence<int, ITERABLE_TYPES>());
+}
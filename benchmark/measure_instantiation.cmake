@@ -0,0 +1,65 @@
+# Compiles SOURCE (instantiate.cpp) with and without the library and reports
+# the compile time and the number of template functions of namespace
+# Iterable emitted per container type.
+#
+#   cmake -DCOMPILER=<c++> -DSTANDARD=<-std=c++17> -DINCLUDE=<include dir>
+#         -DSOURCE=<instantiate.cpp> -DOUTPUT=<dir> -DTYPES=<n>
+#         [-DBUDGET=<functions per type>] [-DTIME_BUDGET=<milliseconds>]
+#         -P measure_instantiation.cmake
+#
+# Sources are compiled at -O0, where every instantiated function is emitted.
+# The check fails if a budget is exceeded (0 disables it). SOURCE declares
+# three container types per index, so TYPES indices give 3 * TYPES types.
+cmake_minimum_required(VERSION 3.23)
+
+foreach(variable IN ITEMS COMPILER SOURCE INCLUDE OUTPUT TYPES)
+  if(NOT DEFINED ${variable})
+    message(FATAL_ERROR "${variable} is not set")
+  endif()
+endforeach()
+if(NOT DEFINED BUDGET)
+  set(BUDGET 0)
+endif()
+if(NOT DEFINED TIME_BUDGET)
+  set(TIME_BUDGET 0)
+endif()
+
+# Compile with ITERABLE_BASELINE=<baseline>; sets elapsed (ms) and functions
+function(measure baseline)
+  set(assembly ${OUTPUT}/instantiate-${baseline}.s)
+  string(TIMESTAMP start "%s%f" UTC)
+  execute_process(
+    COMMAND ${COMPILER} ${STANDARD} -O0 -S -DITERABLE_TYPES=${TYPES} -DITERABLE_BASELINE=${baseline}
+            -I${INCLUDE} ${SOURCE} -o ${assembly}
+    RESULT_VARIABLE result
+  )
+  string(TIMESTAMP stop "%s%f" UTC)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Compiling ${SOURCE} failed")
+  endif()
+  math(EXPR milliseconds "(${stop} - ${start}) / 1000")
+  file(STRINGS ${assembly} labels REGEX "^_?_Z[A-Za-z0-9_]*8Iterable[A-Za-z0-9_]*:")
+  list(LENGTH labels count)
+  set(elapsed ${milliseconds} PARENT_SCOPE)
+  set(functions ${count} PARENT_SCOPE)
+endfunction()
+
+measure(1)
+set(baseline_elapsed ${elapsed})
+measure(0)
+
+math(EXPR types "${TYPES} * 3")
+math(EXPR per_type_tenths "${functions} * 10 / ${types}")
+math(EXPR per_type "${per_type_tenths} / 10")
+math(EXPR per_type_fraction "${per_type_tenths} % 10")
+math(EXPR overhead "${elapsed} - ${baseline_elapsed}")
+message(STATUS "iterable: ${types} container types, ${functions} template functions "
+               "(${per_type}.${per_type_fraction} per type), "
+               "compiled in ${elapsed} ms (plain structs: ${baseline_elapsed} ms, overhead: ${overhead} ms)")
+
+if(BUDGET GREATER 0 AND per_type_tenths GREATER "${BUDGET}0")
+  message(FATAL_ERROR "Instantiation budget exceeded: ${per_type}.${per_type_fraction} functions per type, budget ${BUDGET}")
+endif()
+if(TIME_BUDGET GREATER 0 AND overhead GREATER "${TIME_BUDGET}")
+  message(FATAL_ERROR "Compile time budget exceeded: ${overhead} ms over plain structs, budget ${TIME_BUDGET} ms")
+endif()
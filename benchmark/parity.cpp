@@ -0,0 +1,148 @@
+// Kernels that must compile to the same instructions as a hand-written loop.
+// A kernel marked ITERABLE_SAME_AS <Reference> is compared with the reference
+// function of that name by check_parity.cmake, which fails the build if the
+// two differ in their instruction mnemonics (registers, labels and block
+// order are ignored). Kernels are extern "C" so their assembly labels are
+// their names.
+#include <cstddef>
+#include "containers.h"
+
+namespace {
+/// Fixed-size container with a `static constexpr Length()`
+struct Fixed : Iterable::For<Fixed> {
+  int values[64];
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  static constexpr std::size_t Length() { return 64; }
+};
+
+/// Every second element through `Tag::Strided`
+struct Strided : Iterable::For<Strided, Iterable::Strided> {
+  std::vector<int> values;
+
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size() / 2; }
+  static constexpr std::size_t Stride() { return 2; }
+};
+} // namespace
+
+extern "C" {
+
+int SumIndexedRaw(const Bench::Indexed &container) {
+  int sum = 0;
+  for (std::size_t index = 0, length = container.Length(); index != length; ++index) {
+    sum += container[index];
+  }
+  return sum;
+}
+
+int SumIndexed(const Bench::Indexed &container) { // ITERABLE_SAME_AS SumIndexedRaw
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumCounted(const Bench::Indexed &container) { // ITERABLE_SAME_AS SumIndexedRaw
+  int sum = 0;
+  for (int value : container.Counted()) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumContiguousRaw(const Bench::Contiguous &container) {
+  int sum = 0;
+  for (std::size_t index = 0, length = container.Length(); index != length; ++index) {
+    sum += container[index];
+  }
+  return sum;
+}
+
+int SumContiguous(const Bench::Contiguous &container) { // ITERABLE_SAME_AS SumContiguousRaw
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumPointerRaw(const Bench::Pointer &container) {
+  int sum = 0;
+  for (int value : container.values) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumPointer(const Bench::Pointer &container) { // ITERABLE_SAME_AS SumPointerRaw
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumPassthroughRaw(const Bench::Passthrough &container) {
+  int sum = 0;
+  for (int value : container.data_) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumPassthrough(const Bench::Passthrough &container) { // ITERABLE_SAME_AS SumPassthroughRaw
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumFixedRaw(const Fixed &container) {
+  int sum = 0;
+  for (std::size_t index = 0; index != 64; ++index) {
+    sum += container[index];
+  }
+  return sum;
+}
+
+int SumFixed(const Fixed &container) { // ITERABLE_SAME_AS SumFixedRaw
+  int sum = 0;
+  for (int value : container.Counted()) {
+    sum += value;
+  }
+  return sum;
+}
+
+int SumStridedRaw(const Strided &container) {
+  int sum = 0;
+  for (std::size_t index = 0, length = container.Length(); index != length; ++index) {
+    sum += container[index * 2];
+  }
+  return sum;
+}
+
+int SumStrided(const Strided &container) { // ITERABLE_SAME_AS SumStridedRaw
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  return sum;
+}
+
+void ScaleIndexedRaw(Bench::Indexed &container) {
+  for (std::size_t index = 0, length = container.Length(); index != length; ++index) {
+    container[index] *= 3;
+  }
+}
+
+void ScaleIndexed(Bench::Indexed &container) { // ITERABLE_SAME_AS ScaleIndexedRaw
+  for (int &value : container) {
+    value *= 3;
+  }
+}
+
+} // extern "C"
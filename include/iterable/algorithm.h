@@ -0,0 +1,199 @@
+/**
+ * @file
+ * @brief Provides algorithm overloads that exploit the layout behind `Iterator`.
+ *
+ * The overloads share the names of the standard algorithms so that
+ * unqualified calls (`using std::copy; copy(first, last, out);`) find them
+ * through argument-dependent lookup and prefer them over the generic versions.
+ *
+ * Over index-based iterators whose positions are contiguous container
+ * indices (`Default`, `Contiguous` and `Proxy`), `copy`, `fill` and `find`
+ * dispatch to bulk members of the container when it provides them, receiving
+ * the index range `[first, last)`:
+ * - `O BulkCopy(N first, N last, O out)`, returning the output past the copy
+ * - `void BulkFill(N first, N last, const V &value)`
+ * - `N Find(N first, N last, const V &value)`, returning `last` if not found
+ *
+ * Containers without them, and `Strided` iterators, whose elements are not
+ * contiguous, use the standard algorithm element by element.
+ */
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <iterable/define.h>
+#include <iterable/iterator.h>
+
+namespace Iterable {
+namespace Detail {
+
+/**
+ * @brief Invoke `block(first, last)` for each contiguous block of a segmented range.
+ *
+ * @param first Iterator to the first element
+ * @param last Iterator one past the last element
+ * @param block Callable taking a pair of element pointers
+ */
+template <typename D, typename N, typename B>
+void ForEachSegment(Iterator<D, Tag::Segmented, N> first, Iterator<D, Tag::Segmented, N> last, B &&block) {
+  while (first != last) {
+    auto stop = first.SegmentIndex() == last.SegmentIndex() ? last.Position() : first.SegmentEnd();
+    block(first.Position(), stop);
+    if (stop == last.Position()) {
+      break;
+    }
+    first = Iterator<D, Tag::Segmented, N>(first.Container(), first.SegmentIndex() + 1);
+  }
+}
+
+/**
+ * @brief Helper struct to detect if a container has `BulkCopy(first, last, out)`.
+ *
+ * @tparam D The container type to inspect.
+ * @tparam O The output iterator type.
+ * @tparam Dummy Used for SFINAE.
+ */
+template <typename D, typename O, typename = std::void_t<>>
+struct HasBulkCopyS {
+  static constexpr bool Value = false; ///< Indicates `BulkCopy()` is not present.
+};
+
+/**
+ * @brief Specialization for containers that have `BulkCopy()`.
+ */
+template <typename D, typename O>
+struct HasBulkCopyS<D, O, std::void_t<decltype(std::declval<D &>().BulkCopy(Index<D>(), Index<D>(), std::declval<O>()))>> {
+  static constexpr bool Value = true; ///< Indicates `BulkCopy()` is present.
+};
+
+/**
+ * @brief Helper struct to detect if a container has `BulkFill(first, last, value)`.
+ *
+ * @tparam D The container type to inspect.
+ * @tparam V The value type.
+ * @tparam Dummy Used for SFINAE.
+ */
+template <typename D, typename V, typename = std::void_t<>>
+struct HasBulkFillS {
+  static constexpr bool Value = false; ///< Indicates `BulkFill()` is not present.
+};
+
+/**
+ * @brief Specialization for containers that have `BulkFill()`.
+ */
+template <typename D, typename V>
+struct HasBulkFillS<D, V, std::void_t<decltype(std::declval<D &>().BulkFill(Index<D>(), Index<D>(), std::declval<const V &>()))>> {
+  static constexpr bool Value = true; ///< Indicates `BulkFill()` is present.
+};
+
+/**
+ * @brief Helper struct to detect if a container has `Find(first, last, value)`.
+ *
+ * @tparam D The container type to inspect.
+ * @tparam V The value type.
+ * @tparam Dummy Used for SFINAE.
+ */
+template <typename D, typename V, typename = std::void_t<>>
+struct HasFindS {
+  static constexpr bool Value = false; ///< Indicates `Find()` is not present.
+};
+
+/**
+ * @brief Specialization for containers that have `Find()`.
+ */
+template <typename D, typename V>
+struct HasFindS<D, V, std::void_t<decltype(std::declval<D &>().Find(Index<D>(), Index<D>(), std::declval<const V &>()))>> {
+  static constexpr bool Value = true; ///< Indicates `Find()` is present.
+};
+
+// Whether iterators with tag `T` cover the contiguous indices `[first, last)`
+template <Tag T>
+inline constexpr bool BulkIndexed = T == Tag::Default || T == Tag::Contiguous || T == Tag::Proxy;
+
+} // namespace Detail
+
+/**
+ * @brief `copy` dispatching to `D::BulkCopy()` when available.
+ *
+ * @param first Iterator to the first element
+ * @param last Iterator one past the last element
+ * @param out Output iterator
+ * @return Output iterator past the last copied element
+ */
+template <typename D, Tag T, typename N, typename O>
+O copy(Iterator<D, T, N> first, Iterator<D, T, N> last, O out) {
+  if constexpr (Detail::BulkIndexed<T> && Detail::HasBulkCopyS<D, O>::Value) {
+    return first.Container()->BulkCopy(first.Index(), last.Index(), std::move(out));
+  } else {
+    return std::copy(first, last, std::move(out));
+  }
+}
+
+/**
+ * @brief `fill` dispatching to `D::BulkFill()` when available.
+ *
+ * @param first Iterator to the first element
+ * @param last Iterator one past the last element
+ * @param value Value assigned to every element
+ */
+template <typename D, Tag T, typename N, typename V>
+void fill(Iterator<D, T, N> first, Iterator<D, T, N> last, const V &value) {
+  if constexpr (Detail::BulkIndexed<T> && Detail::HasBulkFillS<D, V>::Value) {
+    first.Container()->BulkFill(first.Index(), last.Index(), value);
+  } else {
+    std::fill(first, last, value);
+  }
+}
+
+/**
+ * @brief `find` dispatching to `D::Find()` when available.
+ *
+ * @param first Iterator to the first element
+ * @param last Iterator one past the last element
+ * @param value Value to search for
+ * @return Iterator to the first element equal to `value`, or `last`
+ */
+template <typename D, Tag T, typename N, typename V>
+Iterator<D, T, N> find(Iterator<D, T, N> first, Iterator<D, T, N> last, const V &value) {
+  if constexpr (Detail::BulkIndexed<T> && Detail::HasFindS<D, V>::Value) {
+    return first + static_cast<std::ptrdiff_t>(first.Container()->Find(first.Index(), last.Index(), value) - first.Index());
+  } else {
+    return std::find(first, last, value);
+  }
+}
+
+/**
+ * @brief Segment-aware `for_each`: runs a pointer loop over each segment.
+ *
+ * @param first Iterator to the first element
+ * @param last Iterator one past the last element
+ * @param fn Callable invoked with each element
+ * @return `fn` after all invocations
+ */
+template <typename D, typename N, typename F>
+F for_each(Iterator<D, Tag::Segmented, N> first, Iterator<D, Tag::Segmented, N> last, F fn) {
+  Detail::ForEachSegment(first, last, [&fn](auto *begin, auto *end) {
+    for (; begin != end; ++begin) {
+      fn(*begin);
+    }
+  });
+  return fn;
+}
+
+/**
+ * @brief Segment-aware `copy`: copies each segment as a contiguous block.
+ *
+ * @param first Iterator to the first element
+ * @param last Iterator one past the last element
+ * @param out Output iterator
+ * @return Output iterator past the last copied element
+ */
+template <typename D, typename N, typename O>
+O copy(Iterator<D, Tag::Segmented, N> first, Iterator<D, Tag::Segmented, N> last, O out) {
+  Detail::ForEachSegment(first, last, [&out](auto *begin, auto *end) {
+    out = std::copy(begin, end, out);
+  });
+  return out;
+}
+} // namespace Iterable
@@ -0,0 +1,285 @@
+/**
+ * @file
+ * @brief Provides a type-erased range of values iterated in batches.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <iterable/define.h>
+#include <iterable/range.h>
+#include <iterable/view.h>
+
+namespace Iterable {
+namespace Detail {
+
+// Interface of the erased range
+template <typename T>
+class AnySource {
+ public:
+  virtual ~AnySource() = default;
+
+  // Copy up to `capacity` next elements to `out`; returns the number copied
+  virtual std::size_t NextBatch(T *out, std::size_t capacity) = 0;
+
+  // Restart from the first element
+  virtual void Reset() = 0;
+
+  // Move-construct into `storage` (suitably sized and aligned), restarting the copy
+  virtual AnySource *MoveTo(void *storage) noexcept = 0;
+};
+
+// Erased range over `R`, referenced when given as an lvalue, owned otherwise
+template <typename T, typename R>
+class AnySourceImpl final : public AnySource<T> {
+  static constexpr bool Referenced = std::is_lvalue_reference_v<R>;
+  using Held = std::conditional_t<Referenced, std::remove_reference_t<R> *, std::decay_t<R>>;
+
+ public:
+  explicit AnySourceImpl(R &&range)
+    : range_(Hold(std::forward<R>(range))), current_(std::begin(Get())), last_(std::end(Get())) {}
+
+  AnySourceImpl(AnySourceImpl &&other) noexcept(std::is_nothrow_move_constructible_v<Held>)
+    : range_(std::move(other.range_)), current_(std::begin(Get())), last_(std::end(Get())) {}
+
+  std::size_t NextBatch(T *out, std::size_t capacity) override {
+    if constexpr (RandomAccess) {
+      auto count = std::min(capacity, static_cast<std::size_t>(last_ - current_));
+      std::copy_n(current_, count, out);
+      current_ += static_cast<std::ptrdiff_t>(count);
+      return count;
+    } else {
+      std::size_t count = 0;
+      for (; count < capacity && current_ != last_; ++current_, ++count) {
+        out[count] = *current_;
+      }
+      return count;
+    }
+  }
+
+  void Reset() override {
+    current_ = std::begin(Get());
+    last_ = std::end(Get());
+  }
+
+  AnySource<T> *MoveTo(void *storage) noexcept override {
+    return ::new (storage) AnySourceImpl(std::move(*this));
+  }
+
+ private:
+  using Range    = std::remove_reference_t<R>;
+  using Position = decltype(std::begin(std::declval<Range &>()));
+  using Last     = decltype(std::end(std::declval<Range &>()));
+
+  static constexpr bool RandomAccess =
+    std::is_same_v<Position, Last> &&
+    std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Position>::iterator_category>;
+
+  Held range_;       ///< Iterated range or pointer to it
+  Position current_; ///< Next element
+  Last last_;        ///< End of the range
+
+  static Held Hold(R &&range) {
+    if constexpr (Referenced) {
+      return std::addressof(range);
+    } else {
+      return std::move(range);
+    }
+  }
+
+  Range &Get() noexcept {
+    if constexpr (Referenced) {
+      return *range_;
+    } else {
+      return range_;
+    }
+  }
+};
+
+} // namespace Detail
+
+/**
+ * @brief Type-erased range of `T`, for interfaces that cannot be templated on
+ * the container type.
+ *
+ * Wraps any range (a `For`-derived type, a view, a standard container). An
+ * lvalue is referenced and must outlive the `AnyRange`; an rvalue is moved
+ * in. The wrapper is stored inline when it fits in `Inline` bytes and is
+ * nothrow movable, otherwise on the heap.
+ *
+ * Elements are copied out in batches through one virtual call per batch,
+ * either into a caller buffer with `NextBatch()` or into an internal buffer
+ * of `Batch` elements when iterating with `begin()`/`end()`. Iteration is
+ * single-pass; `begin()` and moving the `AnyRange` restart from the first
+ * element.
+ *
+ * @tparam T Element type (default constructible and copy assignable)
+ * @tparam Batch Elements per batch when iterating
+ * @tparam Inline Bytes of inline storage
+ */
+template <typename T, std::size_t Batch = 64, std::size_t Inline = 64>
+class AnyRange {
+  static_assert(Batch > 0, "Batch size must be positive");
+
+ public:
+  /// Input iterator over the elements, refilling the buffer batch by batch
+  class Iterator : public Detail::ViewIteratorBase<Iterator> {
+   public:
+    using value_type = T;         ///< Value type
+    using reference  = const T &; ///< Reference type
+    using pointer    = const T *; ///< Pointer type
+
+    /// Default constructor
+    Iterator() = default;
+
+    /// Construct at the current position of `range`
+    explicit Iterator(AnyRange *range) noexcept
+      : range_(range) {}
+
+    /// Dereference operator
+    const T &operator*() const noexcept {
+      return range_->buffer_[range_->position_];
+    }
+
+    /// Member access operator
+    const T *operator->() const noexcept {
+      return std::addressof(operator*());
+    }
+
+    /// Prefix increment
+    Iterator &operator++() {
+      if (++range_->position_ == range_->count_) {
+        range_->Refill();
+      }
+      return *this;
+    }
+
+    /// Postfix increment (returns nothing, as for other buffered input iterators)
+    void operator++(int) {
+      ++*this;
+    }
+
+    /// Checks whether the range is exhausted
+    bool Done() const noexcept {
+      return range_->count_ == 0;
+    }
+
+   private:
+    AnyRange *range_ = nullptr; ///< Iterated range
+  };
+
+  /**
+   * @brief Wrap a range.
+   *
+   * @param range Range to reference (lvalue) or take over (rvalue)
+   */
+  template <typename R, typename = std::enable_if_t<!std::is_same_v<std::decay_t<R>, AnyRange>>>
+  AnyRange(R &&range) {
+    using Impl = Detail::AnySourceImpl<T, R &&>;
+    if constexpr (sizeof(Impl) <= Inline && alignof(Impl) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible_v<Impl>) {
+      source_ = ::new (static_cast<void *>(&storage_)) Impl(std::forward<R>(range));
+    } else {
+      source_ = new Impl(std::forward<R>(range));
+    }
+  }
+
+  /// Destroys the wrapper
+  ~AnyRange() {
+    Destroy();
+  }
+
+  AnyRange(const AnyRange &other) = delete;
+  AnyRange &operator=(const AnyRange &other) = delete;
+
+  /// Move constructor (restarts iteration)
+  AnyRange(AnyRange &&other) noexcept {
+    Take(other);
+  }
+
+  /// Move assignment (restarts iteration)
+  AnyRange &operator=(AnyRange &&other) noexcept {
+    if (this != &other) {
+      Destroy();
+      Take(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Copy the next elements into `buffer`.
+   *
+   * @param buffer Destination
+   * @return The filled prefix of `buffer`, empty at the end of the range
+   */
+  Range<T *> NextBatch(Range<T *> buffer) {
+    auto count = source_->NextBatch(buffer.begin(), static_cast<std::size_t>(buffer.size()));
+    return Range<T *>(buffer.begin(), buffer.begin() + count);
+  }
+
+  /// Restart from the first element
+  void Reset() {
+    source_->Reset();
+    position_ = count_ = 0;
+  }
+
+  /// Iterator to the first element (restarts the range)
+  Iterator begin() {
+    Reset();
+    Refill();
+    return Iterator(this);
+  }
+
+  /// Sentinel one past the last element
+  ViewEnd end() const noexcept {
+    return {};
+  }
+
+ private:
+  Detail::AnySource<T> *source_ = nullptr;                  ///< Erased range
+  alignas(std::max_align_t) unsigned char storage_[Inline]; ///< Inline storage for `source_`
+  std::array<T, Batch> buffer_{};                           ///< Current batch
+  std::size_t position_ = 0;                                ///< Current element of the batch
+  std::size_t count_ = 0;                                   ///< Elements in the batch
+
+  bool IsInline() const noexcept {
+    return static_cast<const void *>(source_) == static_cast<const void *>(&storage_);
+  }
+
+  void Refill() {
+    position_ = 0;
+    count_ = source_->NextBatch(buffer_.data(), Batch);
+  }
+
+  // Take over the wrapper of `other`, restarting from the first element
+  void Take(AnyRange &other) noexcept {
+    if (other.IsInline()) {
+      source_ = other.source_->MoveTo(&storage_);
+    } else {
+      source_ = std::exchange(other.source_, nullptr);
+      if (source_ != nullptr) {
+        source_->Reset();
+      }
+    }
+    position_ = count_ = 0;
+  }
+
+  void Destroy() noexcept {
+    if (source_ == nullptr) {
+      return;
+    }
+    if (IsInline()) {
+      source_->~AnySource();
+    } else {
+      delete source_;
+    }
+    source_ = nullptr;
+  }
+};
+} // namespace Iterable
@@ -0,0 +1,406 @@
+/**
+ * @file
+ * @brief Provides a monotonic arena and contiguous containers allocated from it.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <iterable/iterable.h>
+
+namespace Iterable {
+/// Alignment of arena blocks and container storage
+inline constexpr std::size_t CacheLine = 64;
+
+/**
+ * @brief Monotonic allocator handing out memory from a chain of blocks.
+ *
+ * Allocation bumps an offset and never frees individually. `Reset()` rewinds
+ * to the first block while keeping every block, so a request-scoped arena
+ * stops allocating from the heap once it has seen its largest request.
+ * Memory handed out before `Reset()` (and containers using it) must no longer
+ * be used afterwards.
+ */
+class Arena {
+ public:
+  /**
+   * @brief Construct an empty arena.
+   *
+   * @param block_size Size of each block in bytes (larger requests get their own block)
+   */
+  explicit Arena(std::size_t block_size = 64 * 1024) noexcept
+    : block_size_(block_size) {}
+
+  /// Frees all blocks
+  ~Arena() {
+    Release();
+  }
+
+  Arena(const Arena &other) = delete;
+  Arena &operator=(const Arena &other) = delete;
+
+  /// Move constructor
+  Arena(Arena &&other) noexcept
+    : block_size_(other.block_size_),
+      first_(std::exchange(other.first_, nullptr)),
+      current_(std::exchange(other.current_, nullptr)),
+      offset_(std::exchange(other.offset_, 0)) {}
+
+  /// Move assignment
+  Arena &operator=(Arena &&other) noexcept {
+    if (this != &other) {
+      Release();
+      block_size_ = other.block_size_;
+      first_ = std::exchange(other.first_, nullptr);
+      current_ = std::exchange(other.current_, nullptr);
+      offset_ = std::exchange(other.offset_, 0);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Allocate uninitialized memory.
+   *
+   * @param bytes Size in bytes
+   * @param alignment Alignment (a power of two, at most `CacheLine`)
+   * @return Pointer to the memory, valid until `Reset()` or `Release()`
+   * @throws std::bad_alloc If a new block cannot be allocated
+   */
+  void *Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+    ITERABLE_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0 && alignment <= CacheLine,
+                    "Arena alignment must be a power of two up to CacheLine");
+    if (current_ != nullptr) {
+      auto offset = Align(offset_, alignment);
+      if (offset <= current_->size && bytes <= current_->size - offset) {
+        offset_ = offset + bytes;
+        return current_->Data() + offset;
+      }
+      // Reuse the next block kept by Reset() if the request fits
+      if (current_->next != nullptr && bytes <= current_->next->size) {
+        current_ = current_->next;
+        offset_ = bytes;
+        return current_->Data();
+      }
+    }
+    auto *block = NewBlock(std::max(bytes, block_size_));
+    if (current_ == nullptr) {
+      first_ = block;
+    } else {
+      block->next = current_->next;
+      current_->next = block;
+    }
+    current_ = block;
+    offset_ = bytes;
+    return current_->Data();
+  }
+
+  /**
+   * @brief Allocate uninitialized, `CacheLine`-aligned storage for `count` objects.
+   *
+   * @param count Number of objects
+   */
+  template <typename U>
+  U *AllocateArray(std::size_t count) {
+    static_assert(alignof(U) <= CacheLine, "Arena objects must be at most cache-line aligned");
+    if (count > static_cast<std::size_t>(-1) / sizeof(U)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<U *>(Allocate(count * sizeof(U), CacheLine));
+  }
+
+  /// Make all memory available again, keeping the blocks
+  void Reset() noexcept {
+    current_ = first_;
+    offset_ = 0;
+  }
+
+  /// Free all blocks
+  void Release() noexcept {
+    while (first_ != nullptr) {
+      auto *next = first_->next;
+      ::operator delete(static_cast<void *>(first_), std::align_val_t{CacheLine});
+      first_ = next;
+    }
+    current_ = nullptr;
+    offset_ = 0;
+  }
+
+  /// Total size of the blocks held, in bytes
+  std::size_t Capacity() const noexcept {
+    std::size_t capacity = 0;
+    for (auto *block = first_; block != nullptr; block = block->next) {
+      capacity += block->size;
+    }
+    return capacity;
+  }
+
+ private:
+  // Block header, padded so that the data following it is cache-line aligned
+  struct alignas(CacheLine) Block {
+    Block *next = nullptr; ///< Next block of the chain
+    std::size_t size = 0;  ///< Usable size in bytes
+
+    std::byte *Data() noexcept {
+      return reinterpret_cast<std::byte *>(this + 1);
+    }
+  };
+
+  std::size_t block_size_;   ///< Default block size
+  Block *first_ = nullptr;   ///< First block of the chain
+  Block *current_ = nullptr; ///< Block being allocated from
+  std::size_t offset_ = 0;   ///< Used bytes of the current block
+
+  static std::size_t Align(std::size_t offset, std::size_t alignment) noexcept {
+    return (offset + alignment - 1) & ~(alignment - 1);
+  }
+
+  static Block *NewBlock(std::size_t size) {
+    if (size > static_cast<std::size_t>(-1) - sizeof(Block)) {
+      throw std::bad_alloc();
+    }
+    auto *memory = ::operator new(sizeof(Block) + size, std::align_val_t{CacheLine});
+    auto *block = ::new (memory) Block;
+    block->size = size;
+    return block;
+  }
+};
+
+/**
+ * @brief Growable array whose storage comes from an `Arena`.
+ *
+ * Elements are contiguous and cache-line aligned, and iterated through raw
+ * pointers (`Tag::Contiguous` with `Data()`). Destroying the vector destroys
+ * its elements but leaves the memory to the arena; growing abandons the old
+ * storage in the arena until its next `Reset()`, so reserving up front avoids
+ * waste.
+ *
+ * @tparam T Element type
+ */
+template <typename T>
+class ArenaVector : public For<ArenaVector<T>, Tag::Contiguous> {
+ public:
+  /**
+   * @brief Construct an empty vector.
+   *
+   * @param arena Arena providing the storage (must outlive the vector)
+   * @param capacity Initial capacity
+   */
+  explicit ArenaVector(Arena &arena, std::size_t capacity = 0)
+    : arena_(&arena) {
+    Reserve(capacity);
+  }
+
+  /// Destroys the elements
+  ~ArenaVector() {
+    Clear();
+  }
+
+  ArenaVector(const ArenaVector &other) = delete;
+  ArenaVector &operator=(const ArenaVector &other) = delete;
+
+  /// Move constructor
+  ArenaVector(ArenaVector &&other) noexcept
+    : arena_(other.arena_),
+      elements_(std::exchange(other.elements_, nullptr)),
+      length_(std::exchange(other.length_, 0)),
+      capacity_(std::exchange(other.capacity_, 0)) {}
+
+  /// Move assignment
+  ArenaVector &operator=(ArenaVector &&other) noexcept {
+    if (this != &other) {
+      Clear();
+      arena_ = other.arena_;
+      elements_ = std::exchange(other.elements_, nullptr);
+      length_ = std::exchange(other.length_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Append an element.
+   *
+   * @param args Constructor arguments of the element
+   * @return The appended element
+   */
+  template <typename... Args>
+  T &Append(Args &&...args) {
+    if (length_ != capacity_) {
+      auto *element = ::new (static_cast<void *>(elements_ + length_)) T(std::forward<Args>(args)...);
+      length_++;
+      return *element;
+    }
+    // Build the element in the new storage before relocating the old ones,
+    // since `args` may refer to an element of this vector
+    auto capacity = std::max<std::size_t>({capacity_ * 2, CacheLine / sizeof(T), 1});
+    auto *data = arena_->AllocateArray<T>(capacity);
+    auto *element = ::new (static_cast<void *>(data + length_)) T(std::forward<Args>(args)...);
+    try {
+      Relocate(data, capacity);
+    } catch (...) {
+      element->~T();
+      throw;
+    }
+    length_++;
+    return *element;
+  }
+
+  /**
+   * @brief Ensure room for `capacity` elements without reallocating.
+   *
+   * @param capacity Minimum capacity
+   */
+  void Reserve(std::size_t capacity) {
+    if (capacity <= capacity_) {
+      return;
+    }
+    Relocate(arena_->AllocateArray<T>(capacity), capacity);
+  }
+
+  /// Destroy all elements, keeping the capacity
+  void Clear() noexcept {
+    std::destroy(elements_, elements_ + length_);
+    length_ = 0;
+  }
+
+  /// Element access (non-const)
+  T &operator[](std::size_t index) noexcept {
+    return elements_[index];
+  }
+
+  /// Element access (const)
+  const T &operator[](std::size_t index) const noexcept {
+    return elements_[index];
+  }
+
+  /// Number of elements
+  std::size_t Length() const noexcept {
+    return length_;
+  }
+
+  /// Number of elements the storage holds
+  std::size_t Capacity() const noexcept {
+    return capacity_;
+  }
+
+  /// Pointer to the first element (non-const)
+  T *Data() noexcept {
+    return elements_;
+  }
+
+  /// Pointer to the first element (const)
+  const T *Data() const noexcept {
+    return elements_;
+  }
+
+ private:
+  Arena *arena_;             ///< Arena providing the storage
+  T *elements_ = nullptr;    ///< First element
+  std::size_t length_ = 0;   ///< Number of elements
+  std::size_t capacity_ = 0; ///< Number of elements the storage holds
+
+  // Move (or copy, if moving may throw) the elements to `data` of `capacity`
+  void Relocate(T *data, std::size_t capacity) {
+    if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+      std::uninitialized_move(elements_, elements_ + length_, data);
+    } else {
+      std::uninitialized_copy(elements_, elements_ + length_, data);
+    }
+    std::destroy(elements_, elements_ + length_);
+    elements_ = data;
+    capacity_ = capacity;
+  }
+};
+
+/**
+ * @brief Fixed-length array whose storage comes from an `Arena`.
+ *
+ * The runtime-sized counterpart of `std::array`: the length is set at
+ * construction and the elements are contiguous and cache-line aligned.
+ * Destroying the array destroys its elements but leaves the memory to the
+ * arena.
+ *
+ * @tparam T Element type
+ */
+template <typename T>
+class PoolArray : public For<PoolArray<T>, Tag::Contiguous> {
+ public:
+  /**
+   * @brief Construct `length` value-initialized elements.
+   *
+   * @param arena Arena providing the storage (must outlive the array)
+   * @param length Number of elements
+   */
+  PoolArray(Arena &arena, std::size_t length)
+    : elements_(arena.AllocateArray<T>(length)), length_(length) {
+    std::uninitialized_value_construct_n(elements_, length_);
+  }
+
+  /**
+   * @brief Construct `length` copies of `value`.
+   *
+   * @param arena Arena providing the storage (must outlive the array)
+   * @param length Number of elements
+   * @param value Initial value of the elements
+   */
+  PoolArray(Arena &arena, std::size_t length, const T &value)
+    : elements_(arena.AllocateArray<T>(length)), length_(length) {
+    std::uninitialized_fill_n(elements_, length_, value);
+  }
+
+  /// Destroys the elements
+  ~PoolArray() {
+    std::destroy(elements_, elements_ + length_);
+  }
+
+  PoolArray(const PoolArray &other) = delete;
+  PoolArray &operator=(const PoolArray &other) = delete;
+
+  /// Move constructor
+  PoolArray(PoolArray &&other) noexcept
+    : elements_(std::exchange(other.elements_, nullptr)), length_(std::exchange(other.length_, 0)) {}
+
+  /// Move assignment
+  PoolArray &operator=(PoolArray &&other) noexcept {
+    if (this != &other) {
+      std::destroy(elements_, elements_ + length_);
+      elements_ = std::exchange(other.elements_, nullptr);
+      length_ = std::exchange(other.length_, 0);
+    }
+    return *this;
+  }
+
+  /// Element access (non-const)
+  T &operator[](std::size_t index) noexcept {
+    return elements_[index];
+  }
+
+  /// Element access (const)
+  const T &operator[](std::size_t index) const noexcept {
+    return elements_[index];
+  }
+
+  /// Number of elements
+  std::size_t Length() const noexcept {
+    return length_;
+  }
+
+  /// Pointer to the first element (non-const)
+  T *Data() noexcept {
+    return elements_;
+  }
+
+  /// Pointer to the first element (const)
+  const T *Data() const noexcept {
+    return elements_;
+  }
+
+ private:
+  T *elements_ = nullptr;  ///< First element
+  std::size_t length_ = 0; ///< Number of elements
+};
+} // namespace Iterable
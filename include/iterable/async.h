@@ -0,0 +1,441 @@
+/**
+ * @file
+ * @brief Provides coroutine-based asynchronous iteration over paged collections.
+ *
+ * Available with C++20 coroutines (`ITERABLE_COROUTINES`).
+ */
+#pragma once
+
+#include <iterable/define.h>
+
+#if ITERABLE_COROUTINES
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <semaphore>
+#include <type_traits>
+#include <utility>
+
+namespace Iterable {
+template <typename T>
+class Task;
+
+namespace Detail {
+
+// Result storage of a task's promise
+template <typename T>
+struct TaskResult {
+  std::optional<T> value; ///< Returned value
+
+  void return_value(T result) {
+    value.emplace(std::move(result));
+  }
+  T Take() {
+    return std::move(*value);
+  }
+};
+
+template <>
+struct TaskResult<void> {
+  void return_void() noexcept {}
+  void Take() noexcept {}
+};
+
+// Coroutine releasing a semaphore once suspended at its end, used by SyncWait.
+// The semaphore is released from the final awaiter, after the frame (and the
+// task that resumed it) are suspended, so the waiting thread may destroy both
+// as soon as it wakes up even if the task finished on another thread.
+struct Signal {
+  struct promise_type {
+    std::binary_semaphore *done = nullptr; ///< Released at final suspension
+
+    Signal get_return_object() noexcept {
+      return Signal{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    auto final_suspend() noexcept {
+      struct Release {
+        bool await_ready() noexcept { return false; }
+        void await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+          handle.promise().done->release();
+        }
+        void await_resume() noexcept {}
+      };
+      return Release{};
+    }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+
+  std::coroutine_handle<promise_type> handle; ///< Signalling coroutine
+};
+
+inline Signal Notify() {
+  co_return;
+}
+
+// Awaitable returned by a collection's Fetch()
+template <typename D>
+using FetchAwaitable = decltype(std::declval<D &>().Fetch(std::size_t()));
+
+// Page type produced by awaiting a collection's Fetch()
+template <typename A, typename = std::void_t<>>
+struct AwaitResultS {
+  using Type = decltype(std::declval<A>().await_resume());
+};
+template <typename A>
+struct AwaitResultS<A, std::void_t<decltype(std::declval<A>().operator co_await())>> {
+  using Type = decltype(std::declval<A>().operator co_await().await_resume());
+};
+template <typename D>
+using Page = std::decay_t<typename AwaitResultS<FetchAwaitable<D>>::Type>;
+
+// Eagerly started coroutine awaiting one page, so that the fetch runs (up to
+// its first suspension, and to completion if it never suspends) as soon as it
+// is created. Since it may complete on another thread while it is being
+// awaited, completion and awaiting race through `claimed`: whichever comes
+// second resumes the awaiter. A prefetch destroyed while still running is
+// abandoned and destroys its own frame once it completes.
+template <typename P>
+class Prefetch {
+ public:
+  struct promise_type {
+    std::optional<P> page;                ///< Fetched page
+    std::exception_ptr error;             ///< Exception thrown by the fetch
+    std::coroutine_handle<> continuation; ///< Coroutine awaiting the page
+    std::atomic<bool> claimed{false};     ///< Set by the first of completion and awaiting (or abandoning)
+
+    Prefetch get_return_object() noexcept {
+      return Prefetch(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    auto final_suspend() noexcept {
+      struct Final {
+        bool await_ready() noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+          auto &promise = handle.promise();
+          if (!promise.claimed.exchange(true, std::memory_order_acq_rel)) {
+            return std::noop_coroutine();
+          }
+          if (auto continuation = promise.continuation) {
+            return continuation;
+          }
+          handle.destroy();
+          return std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+      };
+      return Final{};
+    }
+    void return_value(P result) {
+      page.emplace(std::move(result));
+    }
+    void unhandled_exception() noexcept {
+      error = std::current_exception();
+    }
+  };
+
+  Prefetch(const Prefetch &other) = delete;
+  Prefetch &operator=(const Prefetch &other) = delete;
+
+  /// Move constructor
+  Prefetch(Prefetch &&other) noexcept
+    : handle_(std::exchange(other.handle_, nullptr)) {}
+
+  /// Destroys the coroutine, or abandons it while it is still running
+  ~Prefetch() {
+    if (handle_ && handle_.promise().claimed.exchange(true, std::memory_order_acq_rel)) {
+      handle_.destroy();
+    }
+  }
+
+  /// Awaiting yields the page once fetched
+  auto operator co_await() & noexcept {
+    struct Awaiter {
+      std::coroutine_handle<promise_type> handle;
+
+      bool await_ready() const noexcept {
+        return handle.promise().claimed.load(std::memory_order_acquire);
+      }
+      bool await_suspend(std::coroutine_handle<> continuation) noexcept {
+        handle.promise().continuation = continuation;
+        return !handle.promise().claimed.exchange(true, std::memory_order_acq_rel);
+      }
+      P await_resume() {
+        if (handle.promise().error) {
+          std::rethrow_exception(handle.promise().error);
+        }
+        return std::move(*handle.promise().page);
+      }
+    };
+    return Awaiter{handle_};
+  }
+
+ private:
+  std::coroutine_handle<promise_type> handle_; ///< Owned coroutine
+
+  explicit Prefetch(std::coroutine_handle<promise_type> handle) noexcept
+    : handle_(handle) {}
+};
+
+// Start fetching `page` of `data`
+template <typename D>
+Prefetch<Page<D>> StartFetch(D &data, std::size_t page) {
+  co_return co_await data.Fetch(page);
+}
+
+} // namespace Detail
+
+/**
+ * @brief Lazily started coroutine producing a `T`.
+ *
+ * The coroutine body runs when the task is awaited, and the awaiting
+ * coroutine is resumed by symmetric transfer once it completes. Exceptions
+ * propagate to the awaiter.
+ *
+ * @tparam T Result type (may be `void`)
+ */
+template <typename T = void>
+class Task {
+ public:
+  /// Coroutine promise
+  struct promise_type : Detail::TaskResult<T> {
+    std::coroutine_handle<> continuation; ///< Coroutine awaiting the result
+    std::exception_ptr error;             ///< Exception thrown by the body
+
+    Task get_return_object() noexcept {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept {
+      return {};
+    }
+    auto final_suspend() noexcept {
+      struct Final {
+        bool await_ready() noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+          auto continuation = handle.promise().continuation;
+          return continuation ? continuation : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+      };
+      return Final{};
+    }
+    void unhandled_exception() noexcept {
+      error = std::current_exception();
+    }
+  };
+
+  /// Default constructor (no coroutine)
+  Task() = default;
+
+  /// Destroys the coroutine
+  ~Task() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  Task(const Task &other) = delete;
+  Task &operator=(const Task &other) = delete;
+
+  /// Move constructor
+  Task(Task &&other) noexcept
+    : handle_(std::exchange(other.handle_, nullptr)) {}
+
+  /// Move assignment
+  Task &operator=(Task &&other) noexcept {
+    if (this != &other) {
+      if (handle_) {
+        handle_.destroy();
+      }
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+
+  /// Awaiting runs the task and yields its result
+  auto operator co_await() && noexcept {
+    struct Awaiter {
+      std::coroutine_handle<promise_type> handle;
+
+      bool await_ready() noexcept {
+        return handle.done();
+      }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+        handle.promise().continuation = continuation;
+        return handle;
+      }
+      T await_resume() {
+        if (handle.promise().error) {
+          std::rethrow_exception(handle.promise().error);
+        }
+        return handle.promise().Take();
+      }
+    };
+    return Awaiter{handle_};
+  }
+
+  /**
+   * @brief Run the task on the calling thread and block until it completes.
+   *
+   * The task may finish on another thread if it awaits operations completed
+   * elsewhere.
+   *
+   * @return Result of the task
+   */
+  friend T SyncWait(Task task) {
+    std::binary_semaphore done{0};
+    auto signal = Detail::Notify();
+    signal.handle.promise().done = &done;
+    task.handle_.promise().continuation = signal.handle;
+    task.handle_.resume();
+    done.acquire();
+    signal.handle.destroy();
+    if (task.handle_.promise().error) {
+      std::rethrow_exception(task.handle_.promise().error);
+    }
+    return task.handle_.promise().Take();
+  }
+
+ private:
+  std::coroutine_handle<promise_type> handle_; ///< Owned coroutine
+
+  explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+    : handle_(handle) {}
+};
+
+/**
+ * @brief Asynchronous iterator over a paged collection.
+ *
+ * The collection provides `Fetch(page)` returning an awaitable of a page (a
+ * range such as `std::vector<T>`); an empty page ends the iteration. When the
+ * iterator starts consuming a page it starts fetching the next one: the
+ * awaitable returned by `Fetch()` is awaited right away by an eagerly started
+ * coroutine, so even a lazy `Task` runs up to its first suspension (or to
+ * completion) while the current page is processed. Elements of a fetched
+ * page are handed out without suspending or allocating; only moving on to
+ * the next page awaits it.
+ *
+ * @tparam D Collection type
+ */
+template <typename D>
+class AsyncIterator {
+ public:
+  using PageType = Detail::Page<D>; ///< Page type
+  using Element  = std::remove_reference_t<decltype(*std::begin(std::declval<PageType &>()))>; ///< Element type
+
+  /**
+   * @brief Awaitable of the next element, returned by `Next()`.
+   *
+   * Ready at once while the current page has elements (or at the end);
+   * otherwise awaiting it awaits the next page.
+   */
+  class NextAwaiter {
+   public:
+    /// Construct for `iterator`
+    explicit NextAwaiter(AsyncIterator &iterator) noexcept
+      : iterator_(&iterator) {}
+
+    bool await_ready() {
+      if (iterator_->Buffered() || !iterator_->pending_) {
+        return true;
+      }
+      refill_.emplace(iterator_->Refill());
+      awaiter_.emplace(std::move(*refill_).operator co_await());
+      return false;
+    }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+      return awaiter_->await_suspend(continuation);
+    }
+    Element *await_resume() {
+      if (awaiter_) {
+        return awaiter_->await_resume();
+      }
+      return iterator_->Buffered() ? iterator_->Take() : nullptr;
+    }
+
+   private:
+    using Awaiter = decltype(std::declval<Task<Element *>>().operator co_await());
+
+    AsyncIterator *iterator_;               ///< Advanced iterator
+    std::optional<Task<Element *>> refill_; ///< Coroutine awaiting the next page
+    std::optional<Awaiter> awaiter_;        ///< Awaiter of `refill_`
+  };
+
+  /**
+   * @brief Construct at the first page of `data`; the first fetch is started here.
+   *
+   * @param data Collection to iterate
+   */
+  explicit AsyncIterator(D &data)
+    : data_(std::addressof(data)), pending_(Detail::StartFetch(data, 0)) {}
+
+  /**
+   * @brief Advance to the next element.
+   *
+   * @return Awaitable of a pointer to the element, valid until the next call, or null at the end
+   */
+  NextAwaiter Next() noexcept {
+    return NextAwaiter(*this);
+  }
+
+ private:
+  using Position = decltype(std::begin(std::declval<PageType &>()));
+
+  D *data_;                                           ///< Iterated collection
+  std::size_t page_ = 0;                              ///< Index of the pending page
+  std::optional<Detail::Prefetch<PageType>> pending_; ///< Page being fetched
+  std::optional<PageType> current_;                   ///< Page being consumed
+  Position position_{};                               ///< Next element of the current page
+
+  // Checks whether the current page has elements left
+  bool Buffered() const {
+    return current_ && position_ != std::end(*current_);
+  }
+
+  // Next element of the current page
+  Element *Take() {
+    return std::addressof(*position_++);
+  }
+
+  // Await the pending page and start fetching the one after it
+  Task<Element *> Refill() {
+    current_.emplace(co_await *pending_);
+    if (std::begin(*current_) == std::end(*current_)) {
+      pending_.reset();
+      co_return nullptr;
+    }
+    pending_.emplace(Detail::StartFetch(*data_, ++page_));
+    position_ = std::begin(*current_);
+    co_return Take();
+  }
+};
+
+/**
+ * @brief Returns an asynchronous iterator over `data`.
+ *
+ * @param data Collection providing `Fetch(page)`
+ */
+template <typename D>
+AsyncIterator<D> AsyncBegin(D &data) {
+  return AsyncIterator<D>(data);
+}
+
+/**
+ * @brief Invoke `fn` on every element of `data`, awaiting pages as needed.
+ *
+ * @param data Collection providing `Fetch(page)`
+ * @param fn Callable invoked with each element
+ */
+template <typename D, typename F>
+Task<> ForEachAsync(D &data, F fn) {
+  AsyncIterator<D> iterator(data);
+  while (auto *element = co_await iterator.Next()) {
+    fn(*element);
+  }
+}
+} // namespace Iterable
+#endif
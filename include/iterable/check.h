@@ -0,0 +1,42 @@
+/**
+ * @file
+ * @brief Provides the assertions of the debug-checked iteration mode.
+ *
+ * Building with `ITERABLE_CHECKED=1` makes `Iterator` verify bounds on
+ * dereference, that compared iterators belong to the same container, and that
+ * the container was not invalidated since the iterator was created. A failed
+ * check prints a message and aborts. Otherwise the checks, and the state they
+ * need, are not compiled at all. Like `_GLIBCXX_DEBUG`, the mode changes the
+ * layout of iterators, so all translation units must agree on it.
+ *
+ * Invalidation is tracked for containers providing `Generation()`, a counter
+ * the container changes whenever it invalidates its iterators. Iteration
+ * through raw pointers (`Data()`) or a public `data_` member is not checked.
+ */
+#pragma once
+
+#include <iterable/define.h>
+
+#if ITERABLE_CHECKED
+#include <cstdio>
+#include <cstdlib>
+
+namespace Iterable {
+namespace Detail {
+
+// Report a failed check and abort
+[[noreturn]] inline void CheckFailed(const char *message, const char *file, int line) noexcept {
+  std::fprintf(stderr, "%s:%d: iterable check failed: %s\n", file, line, message);
+  std::abort();
+}
+
+} // namespace Detail
+} // namespace Iterable
+
+#define ITERABLE_ASSERT(condition, message) \
+  ((condition) ? static_cast<void>(0) : ::Iterable::Detail::CheckFailed(message, __FILE__, __LINE__))
+#define ITERABLE_CHECK(statement) statement
+#else
+#define ITERABLE_ASSERT(condition, message) static_cast<void>(0)
+#define ITERABLE_CHECK(statement) static_cast<void>(0)
+#endif
@@ -0,0 +1,252 @@
+/**
+ * @file
+ * @brief Provides fixed-width chunked and sliding-window iteration.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <iterable/define.h>
+#include <iterable/range.h>
+
+namespace Iterable {
+/**
+ * @brief Iterator over consecutive chunks of `N` elements.
+ *
+ * Dereferencing yields a `Range` spanning the current chunk.
+ *
+ * @tparam I Underlying random access iterator type
+ * @tparam N Chunk width
+ */
+template <typename I, std::size_t N>
+class ChunkIterator {
+  static_assert(N > 0, "Chunk width must be positive");
+
+ public:
+  using iterator_category = std::input_iterator_tag;                         ///< Iterator category tag
+#if ITERABLE_CPP_20
+  using iterator_concept  = std::forward_iterator_tag;                       ///< Iterator concept tag
+#endif
+  using difference_type   = typename std::iterator_traits<I>::difference_type; ///< Difference type
+  using value_type        = Range<I>;                                        ///< Value type
+  using pointer           = void;                                            ///< Pointer type
+  using reference         = Range<I>;                                        ///< Reference type
+
+  /// Default constructor
+  ChunkIterator() = default;
+
+  /**
+   * @brief Construct at the first element of a chunk.
+   *
+   * @param current Iterator to the first element of the chunk
+   */
+  explicit ChunkIterator(I current)
+    : current_(current) {}
+
+  /// Range spanning the current chunk
+  Range<I> operator*() const {
+    return Range<I>(current_, current_ + Width);
+  }
+
+  /// Prefix increment
+  ChunkIterator &operator++() {
+    current_ += Width;
+    return *this;
+  }
+
+  /// Postfix increment
+  ChunkIterator operator++(int) {
+    auto temp = *this;
+    current_ += Width;
+    return temp;
+  }
+
+  // Comparison operators
+  bool operator==(const ChunkIterator &other) const {
+    return current_ == other.current_;
+  }
+  bool operator!=(const ChunkIterator &other) const {
+    return current_ != other.current_;
+  }
+
+ private:
+  static constexpr difference_type Width = static_cast<difference_type>(N);
+
+  I current_{}; ///< Iterator to the first element of the chunk
+};
+
+/**
+ * @brief View splitting `[first, last)` into full chunks of `N` elements.
+ *
+ * Chunks start at multiples of `N` from `first`. Iterating the view visits only
+ * full chunks; the remaining `size() % N` elements are available via `Tail()`.
+ *
+ * @tparam I Underlying random access iterator type
+ * @tparam N Chunk width
+ */
+template <typename I, std::size_t N>
+class ChunkView {
+ public:
+  using difference_type = typename std::iterator_traits<I>::difference_type; ///< Difference type
+
+  /// Default constructor
+  ChunkView() = default;
+
+  /**
+   * @brief Construct over `[first, last)`.
+   *
+   * @param first Iterator to the first element
+   * @param last Iterator one past the last element
+   */
+  ChunkView(I first, I last)
+    : first_(first), tail_(first + (last - first) / Width * Width), last_(last) {}
+
+  /// Iterator to the first full chunk
+  ChunkIterator<I, N> begin() const {
+    return ChunkIterator<I, N>(first_);
+  }
+
+  /// Iterator one past the last full chunk
+  ChunkIterator<I, N> end() const {
+    return ChunkIterator<I, N>(tail_);
+  }
+
+  /// Number of full chunks
+  difference_type size() const {
+    return (tail_ - first_) / Width;
+  }
+
+  /// Checks whether there are no full chunks
+  bool empty() const {
+    return first_ == tail_;
+  }
+
+  /// Elements after the last full chunk (fewer than `N`)
+  Range<I> Tail() const {
+    return Range<I>(tail_, last_);
+  }
+
+ private:
+  static constexpr difference_type Width = static_cast<difference_type>(N);
+
+  I first_{}; ///< Iterator to the first element
+  I tail_{};  ///< Iterator one past the last full chunk
+  I last_{};  ///< Iterator one past the last element
+};
+
+/**
+ * @brief Iterator over overlapping windows of a fixed width.
+ *
+ * Dereferencing yields a `Range` spanning the current window; incrementing
+ * slides the window by one element.
+ *
+ * @tparam I Underlying random access iterator type
+ */
+template <typename I>
+class WindowIterator {
+ public:
+  using iterator_category = std::input_iterator_tag;                         ///< Iterator category tag
+#if ITERABLE_CPP_20
+  using iterator_concept  = std::forward_iterator_tag;                       ///< Iterator concept tag
+#endif
+  using difference_type   = typename std::iterator_traits<I>::difference_type; ///< Difference type
+  using value_type        = Range<I>;                                        ///< Value type
+  using pointer           = void;                                            ///< Pointer type
+  using reference         = Range<I>;                                        ///< Reference type
+
+  /// Default constructor
+  WindowIterator() = default;
+
+  /**
+   * @brief Construct at the first element of a window.
+   *
+   * @param current Iterator to the first element of the window
+   * @param width Number of elements per window
+   */
+  WindowIterator(I current, difference_type width)
+    : current_(current), width_(width) {}
+
+  /// Range spanning the current window
+  Range<I> operator*() const {
+    return Range<I>(current_, current_ + width_);
+  }
+
+  /// Prefix increment
+  WindowIterator &operator++() {
+    ++current_;
+    return *this;
+  }
+
+  /// Postfix increment
+  WindowIterator operator++(int) {
+    auto temp = *this;
+    ++current_;
+    return temp;
+  }
+
+  // Comparison operators
+  bool operator==(const WindowIterator &other) const {
+    return current_ == other.current_;
+  }
+  bool operator!=(const WindowIterator &other) const {
+    return current_ != other.current_;
+  }
+
+ private:
+  I current_{};               ///< Iterator to the first element of the window
+  difference_type width_ = 0; ///< Number of elements per window
+};
+
+/**
+ * @brief View over every window of `width` consecutive elements of `[first, last)`.
+ *
+ * Windows start at each element from `first` up to `last - width`; a range
+ * shorter than `width` has no windows. Windows are non-owning `Range`s over
+ * the underlying iterators, so sliding costs one increment.
+ *
+ * @tparam I Underlying random access iterator type
+ */
+template <typename I>
+class WindowView {
+ public:
+  using difference_type = typename std::iterator_traits<I>::difference_type; ///< Difference type
+
+  /// Default constructor
+  WindowView() = default;
+
+  /**
+   * @brief Construct over `[first, last)`.
+   *
+   * @param first Iterator to the first element
+   * @param last Iterator one past the last element
+   * @param width Number of elements per window (positive)
+   */
+  WindowView(I first, I last, difference_type width)
+    : first_(first), stop_(last - first < width ? first : last - (width - 1)), width_(width) {}
+
+  /// Iterator to the first window
+  WindowIterator<I> begin() const {
+    return WindowIterator<I>(first_, width_);
+  }
+
+  /// Iterator one past the last window
+  WindowIterator<I> end() const {
+    return WindowIterator<I>(stop_, width_);
+  }
+
+  /// Number of windows
+  difference_type size() const {
+    return stop_ - first_;
+  }
+
+  /// Checks whether there are no windows
+  bool empty() const {
+    return first_ == stop_;
+  }
+
+ private:
+  I first_{};                 ///< Iterator to the first element
+  I stop_{};                  ///< Iterator one past the start of the last window
+  difference_type width_ = 0; ///< Number of elements per window
+};
+} // namespace Iterable
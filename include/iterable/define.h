@@ -5,3 +5,18 @@
 #define ITERABLE_CPP_20 0
 #endif
 
+#if ITERABLE_CPP_20 && defined(__cpp_impl_coroutine)
+#define ITERABLE_COROUTINES 1
+#else
+#define ITERABLE_COROUTINES 0
+#endif
+
+// Debug-checked iteration (bounds, container identity, invalidation); off by default
+#ifndef ITERABLE_CHECKED
+#define ITERABLE_CHECKED 0
+#endif
+
+// Instrument every For type by default (see iterable/instrument.h); off by default
+#ifndef ITERABLE_INSTRUMENTED
+#define ITERABLE_INSTRUMENTED 0
+#endif
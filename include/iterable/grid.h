@@ -0,0 +1,270 @@
+/**
+ * @file
+ * @brief Provides row, column and cache-blocked iteration over matrix-like types.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterable/iterable.h>
+
+namespace Iterable {
+template <typename D>
+class ColumnView;
+template <typename D>
+class Tile;
+template <typename D, std::size_t R, std::size_t C>
+class TileView;
+
+/**
+ * @brief CRTP base for row-major two-dimensional containers.
+ *
+ * The derived class provides `Rows()`, `Cols()` and a flat `operator[]` over
+ * `Rows() * Cols()` elements stored row by row. Besides flat iteration (as
+ * with `For`), it provides row and column views and iteration by tiles, so
+ * that traversals against the storage order stay within cache-sized blocks.
+ *
+ * @tparam D The derived class type inheriting from this template.
+ * @tparam T The tag type used for flat and row iteration (default: `Default`).
+ */
+template <typename D, Tag T = Default>
+class For2D : public For<D, T> {
+ public:
+  /// Number of elements (`Rows() * Cols()`)
+  std::size_t Length() const {
+    return static_cast<std::size_t>(This()->Rows()) * static_cast<std::size_t>(This()->Cols());
+  }
+
+  /// Element at `row`, `col` (non-const)
+  decltype(auto) At(std::size_t row, std::size_t col) {
+    return (*This())[row * static_cast<std::size_t>(This()->Cols()) + col];
+  }
+
+  /// Element at `row`, `col` (const)
+  decltype(auto) At(std::size_t row, std::size_t col) const {
+    return (*This())[row * static_cast<std::size_t>(This()->Cols()) + col];
+  }
+
+  /**
+   * @brief Returns a non-owning range over the elements of a row.
+   *
+   * @param row Row index
+   */
+  auto Row(std::size_t row) {
+    auto cols = static_cast<std::ptrdiff_t>(This()->Cols());
+    return this->Slice(static_cast<std::ptrdiff_t>(row) * cols, static_cast<std::ptrdiff_t>(row + 1) * cols);
+  }
+
+  /**
+   * @brief Returns a const non-owning range over the elements of a row.
+   */
+  auto Row(std::size_t row) const {
+    auto cols = static_cast<std::ptrdiff_t>(This()->Cols());
+    return this->Slice(static_cast<std::ptrdiff_t>(row) * cols, static_cast<std::ptrdiff_t>(row + 1) * cols);
+  }
+
+  /**
+   * @brief Returns a view over the elements of a column (strided iteration).
+   *
+   * @param col Column index
+   */
+  ColumnView<D> Column(std::size_t col) {
+    return ColumnView<D>(This(), col);
+  }
+
+  /**
+   * @brief Returns a const view over the elements of a column.
+   */
+  ColumnView<const D> Column(std::size_t col) const {
+    return ColumnView<const D>(This(), col);
+  }
+
+  /**
+   * @brief Returns a view over `R` x `C` tiles covering the container.
+   *
+   * Tiles are visited row by row; those on the last row or column are cut
+   * to the container's size. A tile is a range over its rows, so nested loops
+   * over a tile touch only `R` x `C` elements at a time.
+   *
+   * @tparam R Rows per tile
+   * @tparam C Columns per tile (default: `R`)
+   */
+  template <std::size_t R, std::size_t C = R>
+  TileView<D, R, C> Tiles() {
+    return TileView<D, R, C>(This());
+  }
+
+  /**
+   * @brief Returns a const view over `R` x `C` tiles covering the container.
+   */
+  template <std::size_t R, std::size_t C = R>
+  TileView<const D, R, C> Tiles() const {
+    return TileView<const D, R, C>(This());
+  }
+
+ private:
+  D *This() {
+    return static_cast<D *>(this);
+  }
+  const D *This() const {
+    return static_cast<const D *>(this);
+  }
+};
+
+/**
+ * @brief View over one column of a `For2D` container.
+ *
+ * Iterates with `Tag::Strided`, the stride being the number of columns.
+ *
+ * @tparam D Container type (may be const-qualified)
+ */
+template <typename D>
+class ColumnView : public For<ColumnView<D>, Tag::Strided> {
+ public:
+  static constexpr bool Borrowed = true; ///< Elements belong to the viewed container
+
+  /**
+   * @brief Construct over a column.
+   *
+   * @param container Container viewed
+   * @param col Column index
+   */
+  ColumnView(D *container, std::size_t col)
+    : container_(container), col_(col) {}
+
+  /// Element `index` elements below the first row (before striding)
+  decltype(auto) operator[](std::size_t index) const {
+    return (*container_)[col_ + index];
+  }
+
+  /// Number of rows
+  std::size_t Length() const {
+    return static_cast<std::size_t>(container_->Rows());
+  }
+
+  /// Distance between consecutive elements of the column
+  std::size_t Stride() const {
+    return static_cast<std::size_t>(container_->Cols());
+  }
+
+ private:
+  D *container_;    ///< Container viewed
+  std::size_t col_; ///< Column index
+};
+
+/**
+ * @brief Rectangular block of a `For2D` container.
+ *
+ * Iterating a tile yields its rows, each a non-owning range over the
+ * container's iterators.
+ *
+ * @tparam D Container type (may be const-qualified)
+ */
+template <typename D>
+class Tile : public For<Tile<D>, Tag::Proxy> {
+ public:
+  static constexpr bool Borrowed = true; ///< Elements belong to the viewed container
+
+  /**
+   * @brief Construct over a block.
+   *
+   * @param container Container viewed
+   * @param row First row of the block
+   * @param col First column of the block
+   * @param rows Number of rows
+   * @param cols Number of columns
+   */
+  Tile(D *container, std::size_t row, std::size_t col, std::size_t rows, std::size_t cols)
+    : container_(container), row_(row), col_(col), rows_(rows), cols_(cols) {}
+
+  /// Row `index` of the tile
+  auto operator[](std::size_t index) const {
+    auto offset = (row_ + index) * static_cast<std::size_t>(container_->Cols()) + col_;
+    auto first = container_->begin() + static_cast<std::ptrdiff_t>(offset);
+    return Range<decltype(first)>(first, first + static_cast<std::ptrdiff_t>(cols_));
+  }
+
+  /// Element at `row`, `col` relative to the tile
+  decltype(auto) At(std::size_t row, std::size_t col) const {
+    return container_->At(row_ + row, col_ + col);
+  }
+
+  /// First row of the tile in the container
+  std::size_t RowFirst() const noexcept {
+    return row_;
+  }
+
+  /// First column of the tile in the container
+  std::size_t ColFirst() const noexcept {
+    return col_;
+  }
+
+  /// Number of rows
+  std::size_t Rows() const noexcept {
+    return rows_;
+  }
+
+  /// Number of columns
+  std::size_t Cols() const noexcept {
+    return cols_;
+  }
+
+  /// Number of rows (the `For` container contract)
+  std::size_t Length() const noexcept {
+    return rows_;
+  }
+
+ private:
+  D *container_;     ///< Container viewed
+  std::size_t row_;  ///< First row
+  std::size_t col_;  ///< First column
+  std::size_t rows_; ///< Number of rows
+  std::size_t cols_; ///< Number of columns
+};
+
+/**
+ * @brief View over the `R` x `C` tiles of a `For2D` container, row by row.
+ *
+ * Random access, so tiles can be distributed with `ParallelFor`.
+ *
+ * @tparam D Container type (may be const-qualified)
+ * @tparam R Rows per tile
+ * @tparam C Columns per tile
+ */
+template <typename D, std::size_t R, std::size_t C>
+class TileView : public For<TileView<D, R, C>, Tag::Proxy> {
+  static_assert(R > 0 && C > 0, "Tile dimensions must be positive");
+
+ public:
+  static constexpr bool Borrowed = true; ///< Elements belong to the viewed container
+
+  /**
+   * @brief Construct over a container.
+   *
+   * @param container Container viewed
+   */
+  explicit TileView(D *container)
+    : container_(container),
+      rows_(static_cast<std::size_t>(container->Rows())),
+      cols_(static_cast<std::size_t>(container->Cols())),
+      tile_cols_((cols_ + C - 1) / C) {}
+
+  /// Tile `index`, counting row by row
+  Tile<D> operator[](std::size_t index) const {
+    auto row = index / tile_cols_ * R;
+    auto col = index % tile_cols_ * C;
+    return Tile<D>(container_, row, col, std::min(R, rows_ - row), std::min(C, cols_ - col));
+  }
+
+  /// Number of tiles
+  std::size_t Length() const noexcept {
+    return (rows_ + R - 1) / R * tile_cols_;
+  }
+
+ private:
+  D *container_;          ///< Container viewed
+  std::size_t rows_;      ///< Rows of the container
+  std::size_t cols_;      ///< Columns of the container
+  std::size_t tile_cols_; ///< Tiles per row of tiles
+};
+} // namespace Iterable
@@ -0,0 +1,334 @@
+/**
+ * @file
+ * @brief Provides opt-in instrumentation of iteration over `For` types.
+ *
+ * The instrumentation policy is the third template parameter of `For`. The
+ * default, `NoInstrumentation`, leaves `begin()` and `end()` untouched.
+ * `Instrumented` wraps them in an `InstrumentedIterator` that counts
+ * `begin()`/`end()` calls, traversed elements and traversal time per
+ * container type into `StatsRegistry::Global()`. Building with
+ * `ITERABLE_INSTRUMENTED=1` makes `Instrumented` the default for all types.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <iterable/define.h>
+
+namespace Iterable {
+/**
+ * @brief Iteration counters of one container type.
+ *
+ * Counters are updated with relaxed atomics and may be read while being
+ * updated; each value is exact once the traversals have finished.
+ */
+struct IterationStats {
+  const char *name = nullptr;                ///< Container type name (`typeid(D).name()`)
+  std::atomic<std::uint64_t> begins{0};      ///< Calls to `begin()`
+  std::atomic<std::uint64_t> ends{0};        ///< Calls to `end()`
+  std::atomic<std::uint64_t> elements{0};    ///< Iterator increments and decrements
+  std::atomic<std::uint64_t> nanoseconds{0}; ///< Lifetime of iterators returned by `begin()`
+  IterationStats *next = nullptr;            ///< Next registered entry
+};
+
+/**
+ * @brief Lock-free list of the counters of every instrumented container type.
+ *
+ * Entries are registered on first use and live for the whole program.
+ */
+class StatsRegistry {
+ public:
+  /// Registry used by `Instrumented`
+  static StatsRegistry &Global() noexcept {
+    static StatsRegistry registry;
+    return registry;
+  }
+
+  /**
+   * @brief Add an entry; it must outlive the registry.
+   *
+   * @param stats Counters to register
+   */
+  void Register(IterationStats &stats) noexcept {
+    stats.next = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(stats.next, &stats, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+  }
+
+  /**
+   * @brief Invoke `fn` with every registered entry.
+   *
+   * @param fn Callable taking a `const IterationStats &`
+   */
+  template <typename F>
+  void ForEach(F &&fn) const {
+    for (auto *stats = head_.load(std::memory_order_acquire); stats != nullptr; stats = stats->next) {
+      fn(static_cast<const IterationStats &>(*stats));
+    }
+  }
+
+  /// Zero all registered counters
+  void Reset() noexcept {
+    for (auto *stats = head_.load(std::memory_order_acquire); stats != nullptr; stats = stats->next) {
+      stats->begins.store(0, std::memory_order_relaxed);
+      stats->ends.store(0, std::memory_order_relaxed);
+      stats->elements.store(0, std::memory_order_relaxed);
+      stats->nanoseconds.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::atomic<IterationStats *> head_{nullptr}; ///< Most recently registered entry
+};
+
+/**
+ * @brief Returns the counters of container type `D`, registering them on first use.
+ *
+ * @tparam D Container type
+ */
+template <typename D>
+IterationStats &Stats() noexcept {
+  static IterationStats *stats = [] {
+    static IterationStats entry;
+    entry.name = typeid(D).name();
+    StatsRegistry::Global().Register(entry);
+    return &entry;
+  }();
+  return *stats;
+}
+
+/**
+ * @brief Policy leaving iteration uninstrumented (the default).
+ */
+struct NoInstrumentation {
+  static constexpr bool Enabled = false; ///< Whether `For` wraps its iterators
+};
+
+/**
+ * @brief Policy recording iteration into `Stats<D>()`.
+ *
+ * Other policies provide the same static members.
+ */
+struct Instrumented {
+  static constexpr bool Enabled = true; ///< Whether `For` wraps its iterators
+
+  /// Called by `begin()`
+  template <typename D>
+  static void OnBegin() noexcept {
+    Stats<D>().begins.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Called by `end()`
+  template <typename D>
+  static void OnEnd() noexcept {
+    Stats<D>().ends.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Called when an instrumented iterator is destroyed.
+   *
+   * @param elements Elements traversed by the iterator
+   * @param elapsed Lifetime of the iterator (zero unless returned by `begin()`)
+   */
+  template <typename D>
+  static void OnTraversal(std::uint64_t elements, std::chrono::nanoseconds elapsed) noexcept {
+    auto &stats = Stats<D>();
+    stats.elements.fetch_add(elements, std::memory_order_relaxed);
+    stats.nanoseconds.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+  }
+};
+
+#if ITERABLE_INSTRUMENTED
+using DefaultInstrumentation = Instrumented; ///< Policy used when `For` is given none
+#else
+using DefaultInstrumentation = NoInstrumentation; ///< Policy used when `For` is given none
+#endif
+
+/**
+ * @brief Iterator adapter reporting its traversal to a policy.
+ *
+ * Increments and decrements are counted locally and reported once, when the
+ * iterator is destroyed, so the hot loop touches no shared state. Copies
+ * start counting from zero. The iterator returned by `begin()` is also timed
+ * from construction to destruction, which for a range-based for loop (or an
+ * algorithm call) spans the whole traversal.
+ *
+ * @tparam I Underlying iterator type
+ * @tparam D Container type the statistics are recorded for
+ * @tparam P Instrumentation policy
+ */
+template <typename I, typename D, typename P>
+class InstrumentedIterator {
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  using iterator_category = typename std::iterator_traits<I>::iterator_category; ///< Iterator category tag
+  using difference_type   = typename std::iterator_traits<I>::difference_type;   ///< Difference type
+  using value_type        = typename std::iterator_traits<I>::value_type;        ///< Value type
+  using pointer           = typename std::iterator_traits<I>::pointer;           ///< Pointer type
+  using reference         = typename std::iterator_traits<I>::reference;         ///< Reference type
+
+  /// Default constructor
+  InstrumentedIterator() = default;
+
+  /**
+   * @brief Wrap an iterator.
+   *
+   * @param current Underlying iterator
+   * @param timed Whether to time the lifetime of this iterator
+   */
+  explicit InstrumentedIterator(I current, bool timed = false)
+    : current_(current), timed_(timed) {
+    if (timed_) {
+      start_ = Clock::now();
+    }
+  }
+
+  /// Copy constructor (the copy is untimed and counts from zero)
+  InstrumentedIterator(const InstrumentedIterator &other)
+    : current_(other.current_) {}
+
+  /// Move constructor (takes over the count and the timer)
+  InstrumentedIterator(InstrumentedIterator &&other) noexcept
+    : current_(std::move(other.current_)),
+      traversed_(std::exchange(other.traversed_, 0)),
+      timed_(std::exchange(other.timed_, false)),
+      start_(other.start_) {}
+
+  /// Copy assignment (takes the position only)
+  InstrumentedIterator &operator=(const InstrumentedIterator &other) {
+    current_ = other.current_;
+    return *this;
+  }
+
+  /// Move assignment (takes the position only)
+  InstrumentedIterator &operator=(InstrumentedIterator &&other) noexcept {
+    current_ = std::move(other.current_);
+    return *this;
+  }
+
+  /// Reports the traversal to the policy
+  ~InstrumentedIterator() {
+    if (traversed_ != 0 || timed_) {
+      auto elapsed = timed_ ? Clock::now() - start_ : Clock::duration::zero();
+      P::template OnTraversal<D>(traversed_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+    }
+  }
+
+  /// Underlying iterator
+  const I &Base() const noexcept {
+    return current_;
+  }
+
+  /// Dereference operator
+  reference operator*() const {
+    return *current_;
+  }
+
+  /// Member access operator
+  decltype(auto) operator->() const {
+    if constexpr (std::is_pointer_v<I>) {
+      return current_;
+    } else {
+      return current_.operator->();
+    }
+  }
+
+  /// Subscript operator
+  reference operator[](difference_type n) const {
+    return current_[n];
+  }
+
+  /// Prefix increment
+  InstrumentedIterator &operator++() {
+    ++current_;
+    ++traversed_;
+    return *this;
+  }
+
+  /// Postfix increment
+  InstrumentedIterator operator++(int) {
+    InstrumentedIterator temp(current_);
+    ++*this;
+    return temp;
+  }
+
+  /// Prefix decrement
+  InstrumentedIterator &operator--() {
+    --current_;
+    ++traversed_;
+    return *this;
+  }
+
+  /// Postfix decrement
+  InstrumentedIterator operator--(int) {
+    InstrumentedIterator temp(current_);
+    --*this;
+    return temp;
+  }
+
+  /// Compound addition assignment
+  InstrumentedIterator &operator+=(difference_type n) {
+    current_ += n;
+    return *this;
+  }
+
+  /// Compound subtraction assignment
+  InstrumentedIterator &operator-=(difference_type n) {
+    current_ -= n;
+    return *this;
+  }
+
+  /// Addition operator (iterator + n)
+  InstrumentedIterator operator+(difference_type n) const {
+    return InstrumentedIterator(current_ + n);
+  }
+
+  /// Global operator for (n + iterator)
+  friend InstrumentedIterator operator+(difference_type n, const InstrumentedIterator &i) {
+    return i + n;
+  }
+
+  /// Subtraction operator (iterator - n)
+  InstrumentedIterator operator-(difference_type n) const {
+    return InstrumentedIterator(current_ - n);
+  }
+
+  /// Difference between iterators
+  difference_type operator-(const InstrumentedIterator &other) const {
+    return current_ - other.current_;
+  }
+
+  // Comparison operators
+  bool operator==(const InstrumentedIterator &other) const {
+    return current_ == other.current_;
+  }
+  bool operator!=(const InstrumentedIterator &other) const {
+    return current_ != other.current_;
+  }
+  bool operator<(const InstrumentedIterator &other) const {
+    return current_ < other.current_;
+  }
+  bool operator>(const InstrumentedIterator &other) const {
+    return current_ > other.current_;
+  }
+  bool operator<=(const InstrumentedIterator &other) const {
+    return current_ <= other.current_;
+  }
+  bool operator>=(const InstrumentedIterator &other) const {
+    return current_ >= other.current_;
+  }
+
+ private:
+  I current_{};                 ///< Underlying iterator
+  std::uint64_t traversed_ = 0; ///< Increments and decrements not yet reported
+  bool timed_ = false;          ///< Whether this iterator is timed
+  Clock::time_point start_{};   ///< Construction time of a timed iterator
+};
+} // namespace Iterable
@@ -1,9 +1,20 @@
 #pragma once 
 
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <type_traits>
 
+#include <iterable/algorithm.h>
+#include <iterable/check.h>
+#include <iterable/chunk.h>
 #include <iterable/define.h>
+#include <iterable/instrument.h>
 #include <iterable/iterator.h>
+#include <iterable/prefetch.h>
+#include <iterable/range.h>
+#include <iterable/select.h>
+#include <iterable/view.h>
 
 namespace Iterable {
 
@@ -15,11 +26,46 @@ namespace Iterable {
  * 
  * Iteration is enabled either through a public member container `data_`, or by
  * using a custom `Iterator` provided in `iterable/iterator.h`.
+ *
+ * With `Tag::Contiguous`, a derived class that exposes `Data()` returning a
+ * pointer to its first element is iterated through raw pointers, so standard
+ * algorithms and the optimizer see the same types as with `std::vector`.
+ *
+ * With `Tag::Strided`, the derived class also provides `Stride()` (optionally
+ * `static constexpr`), and `Length()` counts the strided elements.
+ *
+ * With `Tag::Segmented`, the derived class provides `SegmentCount()` and
+ * `Segment(index)` instead of `operator[]`, each segment being a range of
+ * element pointers.
+ *
+ * With `Tag::Input`, the derived class is a producer providing `Next()` and
+ * `Done()`; iteration is single-pass and `end()` returns `ViewEnd`.
+ *
+ * A derived class of fixed size may declare `static constexpr Length()`, or a
+ * `static constexpr std::size_t Extent` member. The length is then a constant
+ * in `end()`, and `Counted()` ends in a `Sentinel` carrying it in its type, so
+ * loops have a known trip count and can be fully unrolled.
+ *
+ * Iteration (`begin()`, `end()`, `Counted()`, `Slice()` and the iterators
+ * themselves) is `constexpr`, so a derived class whose constructor,
+ * `operator[]` and `Length()` are `constexpr` can be filled and traversed
+ * in constant expressions, e.g. to build lookup tables at compile time.
+ * `Tag::Input` and instrumented iteration remain run-time only.
+ *
+ * `Drain()` and the rvalue overloads `std::move(container).begin()` and
+ * `end()` iterate through `std::move_iterator`, so consumers move the
+ * elements out. A range-based for loop names its range and always uses the
+ * lvalue overloads; iterate `Drain()` to move there.
+ *
+ * With an enabled instrumentation policy `P` (see `iterable/instrument.h`),
+ * `begin()` and `end()` return `InstrumentedIterator` wrappers reporting the
+ * traversal to `P`; `Tag::Input` iteration and `Counted()` are not wrapped.
  * 
  * @tparam D The derived class type inheriting from this template.
  * @tparam T The tag type used to customize the iterator behavior (default: `Default`).
+ * @tparam P The instrumentation policy (default: `DefaultInstrumentation`).
  */
-template <typename D, Tag T = Default>
+template <typename D, Tag T = Default, typename P = DefaultInstrumentation>
 class For {
   /**
    * @brief Helper struct to detect if a type has a public member `data_`.
@@ -43,38 +89,138 @@ class For {
   /// Compile-time flag indicating if the derived class has a public `data_` member.
   static constexpr bool HasPubContainer = HasPubContainerS<D>::Value;
 
+  /**
+   * @brief Helper struct to detect if a type has a `Data()` member function.
+   * 
+   * @tparam C The type to inspect.
+   * @tparam Dummy Used for SFINAE.
+   */
+  template <typename C, typename = std::void_t<>>
+  struct HasDataS {
+    static constexpr bool Value = false; ///< Indicates `Data()` is not present.
+  };
+
+  /**
+   * @brief Specialization for types that have a `Data()` member function.
+   */
+  template <typename C>
+  struct HasDataS<C, std::void_t<decltype(std::declval<C>().Data())>> {
+    static constexpr bool Value = true; ///< Indicates `Data()` is present.
+  };
+
+  /// Compile-time flag indicating if iteration goes through raw pointers from `Data()`.
+  static constexpr bool HasPointer = T == Tag::Contiguous && HasDataS<D>::Value;
+
+  /// Compile-time length of the derived class, or `DynamicExtent`.
+  static constexpr std::size_t FixedExtent = Detail::Extent<D>;
+
+  /// Compile-time flag indicating if `begin()` and `end()` are instrumented.
+  static constexpr bool IsInstrumented = P::Enabled && T != Tag::Input;
+
   /// @brief Returns a pointer to the derived class (non-const).
-  D *This() {
+  constexpr D *This() {
     return static_cast<D *>(this);
   }
 
   /// @brief Returns a pointer to the derived class (const).
-  const D *This() const {
+  constexpr const D *This() const {
     return static_cast<const D *>(this);
   }
 
+  /// @brief Returns the length of the derived class, as a constant if it is fixed (non-const).
+  constexpr auto Size() {
+    if constexpr (FixedExtent != DynamicExtent) {
+      return static_cast<Detail::Index<D>>(FixedExtent);
+    } else {
+      return This()->Length();
+    }
+  }
+
+  /// @brief Returns the length of the derived class, as a constant if it is fixed (const).
+  constexpr auto Size() const {
+    if constexpr (FixedExtent != DynamicExtent) {
+      return static_cast<Detail::Index<D>>(FixedExtent);
+    } else {
+      return This()->Length();
+    }
+  }
+
+  /// @brief Returns the uninstrumented iterator to the beginning (non-const).
+  constexpr auto First() {
+    if constexpr (HasPubContainer) {
+      return This()->data_.begin();
+    } else if constexpr (HasPointer) {
+      return This()->Data();
+    } else if constexpr (T == Tag::Input) {
+      return Iterator<D, T>(This());
+    } else {
+      return Iterator<D, T>(This(), 0);
+    }
+  }
+
+  /// @brief Returns the uninstrumented iterator to the beginning (const).
+  constexpr auto First() const {
+    if constexpr (HasPubContainer) {
+      return This()->data_.begin();
+    } else if constexpr (HasPointer) {
+      return This()->Data();
+    } else {
+      return Iterator<const D, T>(This(), 0);
+    }
+  }
+
+  /// @brief Returns the uninstrumented iterator to the end (non-const).
+  constexpr auto Last() {
+    if constexpr (HasPubContainer) {
+      return This()->data_.end();
+    } else if constexpr (HasPointer) {
+      return This()->Data() + Size();
+    } else if constexpr (T == Tag::Input) {
+      return ViewEnd();
+    } else if constexpr (T == Tag::Segmented) {
+      return Iterator<D, T>(This(), static_cast<Detail::Index<D>>(This()->SegmentCount()));
+    } else {
+      return Iterator<D, T>(This(), Size());
+    }
+  }
+
+  /// @brief Returns the uninstrumented iterator to the end (const).
+  constexpr auto Last() const {
+    if constexpr (HasPubContainer) {
+      return This()->data_.end();
+    } else if constexpr (HasPointer) {
+      return This()->Data() + Size();
+    } else if constexpr (T == Tag::Segmented) {
+      return Iterator<const D, T>(This(), static_cast<Detail::Index<const D>>(This()->SegmentCount()));
+    } else {
+      return Iterator<const D, T>(This(), Size());
+    }
+  }
+
  public:
   /**
    * @brief Returns an iterator to the beginning of the range (non-const).
-   * @return Iterator or container's `begin()` depending on presence of `data_`.
+   * @return Iterator, pointer or container's `begin()` depending on presence of `data_`.
    */
-  auto begin() {
-    if constexpr (HasPubContainer) {
-      return This()->data_.begin();
+  constexpr auto begin() & {
+    if constexpr (IsInstrumented) {
+      P::template OnBegin<D>();
+      return InstrumentedIterator<decltype(First()), D, P>(First(), true);
     } else {
-      return Iterator<D, T>(This(), 0);
+      return First();
     }
   }
 
   /**
    * @brief Returns a const iterator to the beginning of the range.
-   * @return Const iterator or container's `begin()` depending on presence of `data_`.
+   * @return Const iterator, pointer or container's `begin()` depending on presence of `data_`.
    */
-  auto begin() const {
-    if constexpr (HasPubContainer) {
-      return This()->data_.begin();
+  constexpr auto begin() const & {
+    if constexpr (IsInstrumented) {
+      P::template OnBegin<D>();
+      return InstrumentedIterator<decltype(First()), D, P>(First(), true);
     } else {
-      return Iterator<const D, T>(This(), 0);
+      return First();
     }
   }
 
@@ -82,31 +228,49 @@ class For {
    * @brief Returns a const iterator to the beginning of the range.
    * Equivalent to `begin()` for const objects.
    */
-  auto cbegin() const {
+  constexpr auto cbegin() const {
     return begin();
   }
 
+  /**
+   * @brief Returns an iterator to the beginning of an rvalue range, yielding
+   * rvalue references.
+   *
+   * Called as `std::move(container).begin()`; elements are moved from as they
+   * are read (see `Drain()`). Views declaring `static constexpr bool Borrowed
+   * = true` and `Tag::Input` producers return the lvalue iterator instead.
+   */
+  constexpr auto begin() && {
+    if constexpr (Detail::Borrowed<D> || T == Tag::Input) {
+      return begin();
+    } else {
+      return std::move_iterator(begin());
+    }
+  }
+
   /**
    * @brief Returns an iterator to the end of the range (non-const).
-   * @return Iterator or container's `end()` depending on presence of `data_`.
+   * @return Iterator, pointer or container's `end()` depending on presence of `data_`.
    */
-  auto end() {
-    if constexpr (HasPubContainer) {
-      return This()->data_.end();
+  constexpr auto end() & {
+    if constexpr (IsInstrumented) {
+      P::template OnEnd<D>();
+      return InstrumentedIterator<decltype(Last()), D, P>(Last());
     } else {
-      return Iterator<D, T>(This(), This()->Length());
+      return Last();
     }
   }
 
   /**
    * @brief Returns a const iterator to the end of the range.
-   * @return Const iterator or container's `end()` depending on presence of `data_`.
+   * @return Const iterator, pointer or container's `end()` depending on presence of `data_`.
    */
-  auto end() const {
-    if constexpr (HasPubContainer) {
-      return This()->data_.end();
+  constexpr auto end() const & {
+    if constexpr (IsInstrumented) {
+      P::template OnEnd<D>();
+      return InstrumentedIterator<decltype(Last()), D, P>(Last());
     } else {
-      return Iterator<const D, T>(This(), This()->Length());
+      return Last();
     }
   }
 
@@ -114,9 +278,361 @@ class For {
    * @brief Returns a const iterator to the end of the range.
    * Equivalent to `end()` for const objects.
    */
-  auto cend() const {
+  constexpr auto cend() const {
     return end();
   }
+
+  /**
+   * @brief Returns an iterator to the end of an rvalue range, matching `begin() &&`.
+   */
+  constexpr auto end() && {
+    if constexpr (Detail::Borrowed<D> || T == Tag::Input) {
+      return end();
+    } else {
+      return std::move_iterator(end());
+    }
+  }
+
+  /**
+   * @brief Returns a reverse iterator to the last element (non-const).
+   * @return Container's `rbegin()`, `std::reverse_iterator` over pointers, or
+   * `ReverseIterator` positioned on the last element.
+   */
+  constexpr auto rbegin() {
+    if constexpr (HasPubContainer) {
+      return This()->data_.rbegin();
+    } else if constexpr (HasPointer) {
+      return std::reverse_iterator(end());
+    } else {
+      return ReverseIterator(end() - 1);
+    }
+  }
+
+  /**
+   * @brief Returns a const reverse iterator to the last element.
+   */
+  constexpr auto rbegin() const {
+    if constexpr (HasPubContainer) {
+      return This()->data_.rbegin();
+    } else if constexpr (HasPointer) {
+      return std::reverse_iterator(end());
+    } else {
+      return ReverseIterator(end() - 1);
+    }
+  }
+
+  /**
+   * @brief Returns a const reverse iterator to the last element.
+   * Equivalent to `rbegin()` for const objects.
+   */
+  constexpr auto crbegin() const {
+    return rbegin();
+  }
+
+  /**
+   * @brief Returns a reverse iterator before the first element (non-const).
+   */
+  constexpr auto rend() {
+    if constexpr (HasPubContainer) {
+      return This()->data_.rend();
+    } else if constexpr (HasPointer) {
+      return std::reverse_iterator(begin());
+    } else {
+      return ReverseIterator(begin() - 1);
+    }
+  }
+
+  /**
+   * @brief Returns a const reverse iterator before the first element.
+   */
+  constexpr auto rend() const {
+    if constexpr (HasPubContainer) {
+      return This()->data_.rend();
+    } else if constexpr (HasPointer) {
+      return std::reverse_iterator(begin());
+    } else {
+      return ReverseIterator(begin() - 1);
+    }
+  }
+
+  /**
+   * @brief Returns a const reverse iterator before the first element.
+   * Equivalent to `rend()` for const objects.
+   */
+  constexpr auto crend() const {
+    return rend();
+  }
+
+  /**
+   * @brief Returns a range whose end is a `Sentinel` holding the length.
+   *
+   * `Length()` is read once when the range is created, so a loop over it
+   * compiles to a counted loop even if `Length()` is not trivially inlined.
+   * A fixed length is carried by the sentinel's type instead. Pointer and
+   * `data_` iteration return their own `[begin(), end())`.
+   */
+  constexpr auto Counted() {
+    if constexpr (HasPubContainer || HasPointer) {
+      return Range(begin(), end());
+    } else if constexpr (FixedExtent != DynamicExtent) {
+      using Index = Detail::Index<D>;
+      return Range(Iterator<D, T>(This(), 0), Sentinel<Index, FixedExtent>());
+    } else {
+      using Index = Detail::Index<D>;
+      return Range(Iterator<D, T>(This(), 0), Sentinel<Index>(This()->Length()));
+    }
+  }
+
+  /**
+   * @brief Returns a const range whose end is a `Sentinel` holding the length.
+   */
+  constexpr auto Counted() const {
+    if constexpr (HasPubContainer || HasPointer) {
+      return Range(begin(), end());
+    } else if constexpr (FixedExtent != DynamicExtent) {
+      using Index = Detail::Index<const D>;
+      return Range(Iterator<const D, T>(This(), 0), Sentinel<Index, FixedExtent>());
+    } else {
+      using Index = Detail::Index<const D>;
+      return Range(Iterator<const D, T>(This(), 0), Sentinel<Index>(This()->Length()));
+    }
+  }
+
+  /**
+   * @brief Returns a range over the elements present when it is created.
+   *
+   * `Length()` is read once, before anything else, and bounds the range, so
+   * iterating it while a writer appends (e.g. to an `AppendLog`) visits a
+   * consistent prefix. For this, `Length()` must load the published length
+   * with acquire ordering and appending must not move existing elements.
+   */
+  constexpr auto Snapshot() const {
+    static_assert(!HasPubContainer && T != Tag::Input && T != Tag::Segmented,
+      "Snapshot() requires index or pointer iteration");
+    auto length = Size();
+    if constexpr (HasPointer) {
+      auto first = First();
+      return Range(first, first + length);
+    } else {
+      using Index = Detail::Index<const D>;
+      return Range(Iterator<const D, T>(This(), 0), Sentinel<Index>(static_cast<Index>(length)));
+    }
+  }
+
+  /**
+   * @brief Returns a view over consecutive chunks of `N` elements.
+   *
+   * Each chunk is a `Range` over the same iterator type as `begin()`, so with
+   * `Tag::Contiguous` and `Data()` the chunks are pointer ranges suitable for
+   * SIMD loads. The remainder is available via `Tail()` on the view.
+   *
+   * @tparam N Chunk width
+   */
+  template <std::size_t N>
+  auto Chunks() {
+    return ChunkView<decltype(begin()), N>(begin(), end());
+  }
+
+  /**
+   * @brief Returns a const view over consecutive chunks of `N` elements.
+   *
+   * @tparam N Chunk width
+   */
+  template <std::size_t N>
+  auto Chunks() const {
+    return ChunkView<decltype(begin()), N>(begin(), end());
+  }
+
+  /**
+   * @brief Returns a non-owning range over the elements `[first, last)`.
+   *
+   * The range uses the same iterator type as `begin()`, on every code path
+   * (including `data_` forwarding), so nothing is copied.
+   *
+   * @param first Index of the first element
+   * @param last Index one past the last element
+   */
+  constexpr auto Slice(std::ptrdiff_t first, std::ptrdiff_t last) {
+    ITERABLE_ASSERT(0 <= first && first <= last && last <= end() - begin(), "slice out of range");
+    auto start = begin();
+    return Range<decltype(start)>(start + first, start + last);
+  }
+
+  /**
+   * @brief Returns a const non-owning range over the elements `[first, last)`.
+   */
+  constexpr auto Slice(std::ptrdiff_t first, std::ptrdiff_t last) const {
+    ITERABLE_ASSERT(0 <= first && first <= last && last <= end() - begin(), "slice out of range");
+    auto start = begin();
+    return Range<decltype(start)>(start + first, start + last);
+  }
+
+  /**
+   * @brief Returns a view over every window of `width` consecutive elements.
+   *
+   * Each window is a non-owning `Range` over the same iterator type as
+   * `begin()`, so sliding aggregations need no per-window copies.
+   *
+   * @param width Number of elements per window (positive)
+   */
+  auto Window(std::ptrdiff_t width) {
+    ITERABLE_ASSERT(width > 0, "window width must be positive");
+    return WindowView<decltype(begin())>(begin(), end(), width);
+  }
+
+  /**
+   * @brief Returns a const view over every window of `width` consecutive elements.
+   */
+  auto Window(std::ptrdiff_t width) const {
+    ITERABLE_ASSERT(width > 0, "window width must be positive");
+    return WindowView<decltype(begin())>(begin(), end(), width);
+  }
+
+  /**
+   * @brief Returns a range prefetching `Distance` elements ahead of the scan.
+   *
+   * @tparam Distance Prefetch distance in elements
+   */
+  template <std::size_t Distance = 16>
+  auto Prefetched() {
+    using Prefetch = PrefetchIterator<decltype(begin()), Distance>;
+    return Range<Prefetch>(Prefetch(begin(), end()), Prefetch(end(), end()));
+  }
+
+  /**
+   * @brief Returns a const range prefetching `Distance` elements ahead of the scan.
+   *
+   * @tparam Distance Prefetch distance in elements
+   */
+  template <std::size_t Distance = 16>
+  auto Prefetched() const {
+    using Prefetch = PrefetchIterator<decltype(begin()), Distance>;
+    return Range<Prefetch>(Prefetch(begin(), end()), Prefetch(end(), end()));
+  }
+
+  /**
+   * @brief Returns a lazy view applying `fn` to each element.
+   *
+   * Views compose (`Map(f).Filter(p).Take(n)`) into a single pass without
+   * intermediate containers.
+   *
+   * @param fn Callable invoked with each element on dereference
+   */
+  template <typename F>
+  auto Map(F fn) {
+    return SourceView(begin(), end()).Map(std::move(fn));
+  }
+
+  /**
+   * @brief Returns a const lazy view applying `fn` to each element.
+   */
+  template <typename F>
+  auto Map(F fn) const {
+    return SourceView(begin(), end()).Map(std::move(fn));
+  }
+
+  /**
+   * @brief Returns a lazy view skipping elements not satisfying `pred`.
+   *
+   * @param pred Predicate invoked with each element
+   */
+  template <typename F>
+  auto Filter(F pred) {
+    return SourceView(begin(), end()).Filter(std::move(pred));
+  }
+
+  /**
+   * @brief Returns a const lazy view skipping elements not satisfying `pred`.
+   */
+  template <typename F>
+  auto Filter(F pred) const {
+    return SourceView(begin(), end()).Filter(std::move(pred));
+  }
+
+  /**
+   * @brief Returns a lazy view of at most the first `count` elements.
+   *
+   * @param count Maximum number of elements
+   */
+  auto Take(std::size_t count) {
+    return SourceView(begin(), end()).Take(count);
+  }
+
+  /**
+   * @brief Returns a const lazy view of at most the first `count` elements.
+   */
+  auto Take(std::size_t count) const {
+    return SourceView(begin(), end()).Take(count);
+  }
+
+  /**
+   * @brief Returns a range moving each element out as it is read.
+   *
+   * Consuming the range, e.g. `std::vector<T>(drain.begin(), drain.end())`,
+   * moves rather than copies the elements, which are left in a moved-from
+   * state; the container keeps its length. Iterators are `std::move_iterator`
+   * over `begin()`, or a `Map` view returning rvalue references for
+   * `Tag::Input` producers, whose iterators are not `std::move_iterator`
+   * compatible.
+   */
+  auto Drain() {
+    if constexpr (T == Tag::Input) {
+      return SourceView(begin(), end()).Map(Detail::MoveOut());
+    } else {
+      return Range(std::move_iterator(begin()), std::move_iterator(end()));
+    }
+  }
+
+  /**
+   * @brief Returns a lazy view over the elements whose bit is set in `mask`.
+   *
+   * Bit `i` selects element `i`; the mask may be shorter than the container.
+   * The view is a pipeline like `Map()`, so `Select(mask).Map(f)` is one pass.
+   *
+   * @param mask Selected elements
+   */
+  template <typename W>
+  auto Select(Bitmask<W> mask) {
+    ITERABLE_ASSERT(static_cast<std::ptrdiff_t>(mask.Length()) <= end() - begin(), "mask longer than container");
+    return MaskView<decltype(begin()), W>(begin(), mask);
+  }
+
+  /**
+   * @brief Returns a const lazy view over the elements whose bit is set in `mask`.
+   */
+  template <typename W>
+  auto Select(Bitmask<W> mask) const {
+    ITERABLE_ASSERT(static_cast<std::ptrdiff_t>(mask.Length()) <= end() - begin(), "mask longer than container");
+    return MaskView<decltype(begin()), W>(begin(), mask);
+  }
+
+  /**
+   * @brief Returns a lazy view over the elements at the positions in `indices`.
+   *
+   * @param indices Range of element indices (not copied; must outlive the view)
+   */
+  template <typename R, typename = Detail::EnableIfIndices<R>>
+  auto Select(const R &indices) {
+    ITERABLE_ASSERT(Detail::IndicesWithin(indices, end() - begin()), "index out of range");
+    return IndexView<decltype(begin()), decltype(std::begin(indices))>(begin(), std::begin(indices), std::end(indices));
+  }
+
+  /**
+   * @brief Returns a const lazy view over the elements at the positions in `indices`.
+   */
+  template <typename R, typename = Detail::EnableIfIndices<R>>
+  auto Select(const R &indices) const {
+    ITERABLE_ASSERT(Detail::IndicesWithin(indices, end() - begin()), "index out of range");
+    return IndexView<decltype(begin()), decltype(std::begin(indices))>(begin(), std::begin(indices), std::end(indices));
+  }
+
+  /// The view does not own its indices, so a temporary index list would dangle
+  template <typename R, typename = Detail::EnableIfIndices<R>>
+  void Select(const R &&indices) = delete;
+
+  /// The view does not own its indices, so a temporary index list would dangle
+  template <typename R, typename = Detail::EnableIfIndices<R>>
+  void Select(const R &&indices) const = delete;
 };
 
 };
@@ -4,10 +4,14 @@
  */
 #pragma once 
 
+#include <cstddef>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <type_traits>
+#include <iterable/check.h>
 #include <iterable/define.h>
+#include <iterable/view.h>
 #include <utility>
 
 namespace Iterable {
@@ -17,19 +21,81 @@ namespace Iterable {
  * Allows compile-time selection of iterator capabilities:
  * - `Default`: Standard random access iterator
  * - `Contiguous`: Contiguous memory iterator (C++20 only)
+ * - `Proxy`: Random access iterator yielding whatever `operator[]` returns
+ * - `Strided`: Random access iterator visiting every `Stride()`-th element
+ * - `Segmented`: Forward iterator over contiguous segments from `Segment()`
+ * - `Input`: Single-pass iterator over elements produced by `Next()`
  */
 enum Tag {
   Default,    ///< Standard random access iterator
   Contiguous, ///< Contiguous memory iterator (requires C++20)
+  Proxy,      ///< Iterator over computed elements or proxy references
+  Strided,    ///< Iterator over `operator[](i * Stride())`
+  Segmented,  ///< Iterator over `Segment(0)` ... `Segment(SegmentCount() - 1)`
+  Input,      ///< Single-pass iterator over `Next()` until `Done()`
+};
+
+/// Extent of a range whose length is only known at run time
+inline constexpr std::size_t DynamicExtent = static_cast<std::size_t>(-1);
+
+/**
+ * @brief End marker fixed to a compile-time length.
+ *
+ * Compares against an iterator's index like the dynamic `Sentinel`, but the
+ * length is part of the type, so loops bounded by it have a constant trip
+ * count and can be fully unrolled.
+ *
+ * @tparam N Index type
+ * @tparam E Length of the range (default: `DynamicExtent`, see below)
+ */
+template <typename N, std::size_t E = DynamicExtent>
+class Sentinel {
+ public:
+  /// Index one past the last element
+  static constexpr N Length() noexcept {
+    return static_cast<N>(E);
+  }
+};
+
+/**
+ * @brief End marker holding the length of the range.
+ *
+ * Compares against an iterator's index, so a loop bounded by a sentinel reads
+ * the container's `Length()` only once. Satisfies `std::sized_sentinel_for`
+ * with `Iterator` under C++20.
+ *
+ * @tparam N Index type
+ */
+template <typename N>
+class Sentinel<N, DynamicExtent> {
+ public:
+  /// Default constructor
+  Sentinel() = default;
+
+  /**
+   * @brief Construct with the length of the range.
+   * 
+   * @param length Index one past the last element
+   */
+  constexpr explicit Sentinel(N length) noexcept 
+    : length_(length) {}
+
+  /// Index one past the last element
+  constexpr N Length() const noexcept {
+    return length_;
+  }
+
+ private:
+  N length_ = 0; ///< Cached length
 };
 namespace Detail {
 
 // Conditional iterator tag selection (C++20 activates contiguous support)
 #if ITERABLE_CPP_20
 template <Tag T>
-using ConvertTag = std::conditional_t<T == Tag::Default, 
-  std::random_access_iterator_tag, 
-  std::contiguous_iterator_tag>;
+using ConvertTag = std::conditional_t<T == Tag::Contiguous, 
+  std::contiguous_iterator_tag, 
+  std::random_access_iterator_tag>;
 #else
 template <Tag T>
 using ConvertTag = std::random_access_iterator_tag;
@@ -43,24 +109,196 @@ using OperatorReturn = decltype(std::declval<D>()[0]);
 template <typename D>
 using Stored = std::decay_t<OperatorReturn<D>>;
 
-// Preserve constness when container is const
+// Preserve constness when container is const or yields const elements
+template <typename D>
+using HandledReturn = std::conditional_t<
+  std::is_const_v<D> || std::is_const_v<std::remove_reference_t<OperatorReturn<D>>>,
+  const Stored<D>, Stored<D>>;
+
+// Deduce index type from container's Length(), falling back to std::ptrdiff_t
+template <typename D, typename = std::void_t<>>
+struct IndexS {
+  using Type = std::ptrdiff_t;
+};
+template <typename D>
+struct IndexS<D, std::void_t<decltype(std::declval<D &>().Length())>> {
+  using Type = std::decay_t<decltype(std::declval<D &>().Length())>;
+};
+template <typename D>
+using Index = typename IndexS<std::remove_const_t<D>>::Type;
+
+// Index as a signed offset; the reverse end of an unsigned index type wraps
+// to its maximum, which reads back as -1
+template <typename N>
+constexpr std::ptrdiff_t Signed(N index) noexcept {
+  return static_cast<std::ptrdiff_t>(static_cast<std::make_signed_t<N>>(index));
+}
+
+// Detect a length usable as a constant expression: a static constexpr
+// Length(), or else a static constexpr Extent member
+template <typename D, typename = std::void_t<>>
+struct ExtentS {
+  static constexpr std::size_t Value = DynamicExtent;
+};
+template <typename D>
+struct ExtentS<D, std::void_t<std::integral_constant<std::size_t, D::Extent>>> {
+  static constexpr std::size_t Value = D::Extent;
+};
+template <typename D, typename = std::void_t<>>
+struct StaticLengthS : ExtentS<D> {};
+template <typename D>
+struct StaticLengthS<D, std::void_t<std::integral_constant<decltype(D::Length()), D::Length()>>> {
+  static constexpr std::size_t Value = static_cast<std::size_t>(D::Length());
+};
+template <typename D>
+inline constexpr std::size_t Extent = StaticLengthS<std::remove_const_t<D>>::Value;
+
+// Detect a stride usable as a constant expression (static constexpr Stride())
+template <typename D, typename = std::void_t<>>
+struct StaticStrideS {
+  static constexpr bool Value = false;
+};
+template <typename D>
+struct StaticStrideS<D, std::void_t<std::integral_constant<decltype(D::Stride()), D::Stride()>>> {
+  static constexpr bool Value = true;
+};
+template <typename D>
+inline constexpr bool StaticStride = StaticStrideS<std::remove_const_t<D>>::Value;
+
+// Element pointer type of a segmented container's Segment()
+template <typename D>
+using SegmentPointer = decltype(std::declval<D &>().Segment(std::size_t()).begin());
+
+// Element type of a segmented container
+template <typename D>
+using SegmentElement = std::remove_pointer_t<SegmentPointer<D>>;
+
+// Return type of a producer's Next()
+template <typename D>
+using NextReturn = decltype(std::declval<D &>().Next());
+
+// Detect a Length() callable on the (possibly const) container
+template <typename D, typename = std::void_t<>>
+struct HasLengthS {
+  static constexpr bool Value = false;
+};
+template <typename D>
+struct HasLengthS<D, std::void_t<decltype(std::declval<D &>().Length())>> {
+  static constexpr bool Value = true;
+};
+template <typename D>
+inline constexpr bool HasLength = HasLengthS<D>::Value;
+
+// Detect a view declaring `static constexpr bool Borrowed = true`, whose
+// elements belong to another container and must not be moved from
+template <typename D, typename = std::void_t<>>
+struct BorrowedS {
+  static constexpr bool Value = false;
+};
+template <typename D>
+struct BorrowedS<D, std::void_t<decltype(D::Borrowed)>> {
+  static constexpr bool Value = D::Borrowed;
+};
 template <typename D>
-using HandledReturn = std::conditional_t<std::is_const_v<D>,
-  const Stored<D>, Stored<D>>; 
+inline constexpr bool Borrowed = BorrowedS<std::remove_const_t<D>>::Value;
+
+// Generation of a container providing Generation(), changed whenever its
+// iterators are invalidated; containers without it never invalidate
+template <typename D, typename = std::void_t<>>
+struct GenerationS {
+  static constexpr std::size_t Get(const D *) noexcept {
+    return 0;
+  }
+};
+template <typename D>
+struct GenerationS<D, std::void_t<decltype(std::declval<const D &>().Generation())>> {
+  static constexpr std::size_t Get(const D *data) noexcept {
+    return data != nullptr ? static_cast<std::size_t>(data->Generation()) : 0;
+  }
+};
+template <typename D>
+constexpr std::size_t Generation(const D *data) noexcept {
+  return GenerationS<std::remove_const_t<D>>::Get(data);
+}
 
 /**
  * @brief Provides standard iterator type aliases.
  * 
+ * The category is always `std::random_access_iterator_tag`, as for standard
+ * containers, since parallel algorithm backends compare it exactly and would
+ * otherwise run sequentially. The C++20 concept carries the contiguous tag.
+ *
  * @tparam D Container type
  * @tparam T Iterable::Tag category
  */
 template <typename D, Tag T>
 struct IteratorCompat {
-  using iterator_category = ConvertTag<T>;  ///< Iterator category tag
-  using difference_type   = std::ptrdiff_t; ///< Difference type
-  using value_type        = Stored<D>;      ///< Value type (decayed)
-  using pointer           = Stored<D>*;     ///< Pointer type
-  using reference         = Stored<D>&;     ///< Reference type
+  using iterator_category = std::random_access_iterator_tag; ///< Iterator category tag
+#if ITERABLE_CPP_20
+  using iterator_concept  = ConvertTag<T>;        ///< Iterator concept tag
+#endif
+  using difference_type   = std::ptrdiff_t;       ///< Difference type
+  using value_type        = Stored<D>;            ///< Value type (decayed)
+  using pointer           = HandledReturn<D>*;    ///< Pointer type
+  using reference         = HandledReturn<D>&;    ///< Reference type
+};
+
+/**
+ * @brief Iterator type aliases for proxy iterators.
+ *
+ * `reference` is the exact return type of `operator[]`, which may be a
+ * value or a proxy object; there is no pointer type.
+ *
+ * @tparam D Container type
+ */
+template <typename D>
+struct IteratorCompat<D, Tag::Proxy> {
+  using iterator_category = std::random_access_iterator_tag; ///< Iterator category tag
+#if ITERABLE_CPP_20
+  using iterator_concept  = std::random_access_iterator_tag; ///< Iterator concept tag
+#endif
+  using difference_type   = std::ptrdiff_t;       ///< Difference type
+  using value_type        = Stored<D>;            ///< Value type (decayed)
+  using pointer           = void;                 ///< Pointer type
+  using reference         = OperatorReturn<D>;    ///< Reference type
+};
+
+/**
+ * @brief Iterator type aliases for segmented iterators.
+ *
+ * Element types come from the pointers of `Segment()` rather than `operator[]`.
+ *
+ * @tparam D Container type
+ */
+template <typename D>
+struct IteratorCompat<D, Tag::Segmented> {
+  using iterator_category = std::forward_iterator_tag;             ///< Iterator category tag
+#if ITERABLE_CPP_20
+  using iterator_concept  = std::forward_iterator_tag;             ///< Iterator concept tag
+#endif
+  using difference_type   = std::ptrdiff_t;                        ///< Difference type
+  using value_type        = std::remove_cv_t<SegmentElement<D>>;   ///< Value type
+  using pointer           = SegmentElement<D>*;                    ///< Pointer type
+  using reference         = SegmentElement<D>&;                    ///< Reference type
+};
+
+/**
+ * @brief Iterator type aliases for input iterators.
+ *
+ * Element types come from the return type of `Next()`.
+ *
+ * @tparam D Producer type
+ */
+template <typename D>
+struct IteratorCompat<D, Tag::Input> {
+  using iterator_category = std::input_iterator_tag;                  ///< Iterator category tag
+#if ITERABLE_CPP_20
+  using iterator_concept  = std::input_iterator_tag;                  ///< Iterator concept tag
+#endif
+  using difference_type   = std::ptrdiff_t;                           ///< Difference type
+  using value_type        = std::decay_t<NextReturn<D>>;              ///< Value type
+  using pointer           = std::remove_reference_t<NextReturn<D>>*;  ///< Pointer type
+  using reference         = std::remove_reference_t<NextReturn<D>>&;  ///< Reference type
 };
 
 /**
@@ -70,10 +308,14 @@ struct IteratorCompat {
  * 
  * @tparam D Container type
  * @tparam I Concrete iterator type (CRTP)
+ * @tparam N Index type (integral)
  */
-template <typename D, typename I>
+template <typename D, typename I, typename N>
 class IteratorCore {
+  static_assert(std::is_integral_v<N>, "Index type must be integral");
+
  public:
+  using IndexType = N; ///< Index type
   /// Default constructor
   IteratorCore() = default;
 
@@ -83,8 +325,10 @@ class IteratorCore {
    * @param data Pointer to container
    * @param current Starting index
    */
-  IteratorCore(D *data, int current) 
-    : data_(data), current_(current) {}
+  constexpr IteratorCore(D *data, N current) 
+    : data_(data), current_(current) {
+    ITERABLE_CHECK(generation_ = Generation(data));
+  }
 
   /// Copy constructor
   IteratorCore(const IteratorCore &other) = default;
@@ -97,115 +341,200 @@ class IteratorCore {
   IteratorCore &operator=(IteratorCore &&other) noexcept = default;
 
   /// Prefix increment
-  I &operator++() noexcept {
+  constexpr I &operator++() noexcept {
     current_++; 
     return Reference();
   }
 
   /// Postfix increment
-  I operator++(int) noexcept {
-    auto temp = *this;
-    current_++; 
-    return temp.Reference();
+  constexpr I operator++(int) noexcept {
+    I temp = Reference();
+    current_++;
+    return temp;
   }
 
   // Comparison operators
-  bool operator==(const IteratorCore &other) const noexcept {
+  constexpr bool operator==(const IteratorCore &other) const noexcept {
+    ITERABLE_CHECK(CheckCompatible(other));
     return current_ == other.current_;
   }
-  bool operator!=(const IteratorCore &other) const noexcept {
+  constexpr bool operator!=(const IteratorCore &other) const noexcept {
+    ITERABLE_CHECK(CheckCompatible(other));
     return current_ != other.current_;
   }
-  bool operator<(const IteratorCore &other) const noexcept {
+  constexpr bool operator<(const IteratorCore &other) const noexcept {
+    ITERABLE_CHECK(CheckCompatible(other));
     return current_ < other.current_;
   }
-  bool operator>(const IteratorCore &other) const noexcept {
+  constexpr bool operator>(const IteratorCore &other) const noexcept {
+    ITERABLE_CHECK(CheckCompatible(other));
     return current_ > other.current_;
   }
-  bool operator<=(const IteratorCore &other) const noexcept {
+  constexpr bool operator<=(const IteratorCore &other) const noexcept {
+    ITERABLE_CHECK(CheckCompatible(other));
     return current_ <= other.current_;
   }
-  bool operator>=(const IteratorCore &other) const noexcept {
+  constexpr bool operator>=(const IteratorCore &other) const noexcept {
+    ITERABLE_CHECK(CheckCompatible(other));
     return current_ >= other.current_;
   }
 
+  // Sentinel comparison operators
+  template <std::size_t E>
+  constexpr bool operator==(const Sentinel<N, E> &other) const noexcept {
+    return current_ == other.Length();
+  }
+  template <std::size_t E>
+  constexpr bool operator!=(const Sentinel<N, E> &other) const noexcept {
+    return current_ != other.Length();
+  }
+  template <std::size_t E>
+  friend constexpr bool operator==(const Sentinel<N, E> &lhs, const IteratorCore &rhs) noexcept {
+    return rhs == lhs;
+  }
+  template <std::size_t E>
+  friend constexpr bool operator!=(const Sentinel<N, E> &lhs, const IteratorCore &rhs) noexcept {
+    return rhs != lhs;
+  }
+
+  /// Current position index
+  constexpr N Index() const noexcept {
+    return current_;
+  }
+
+  /// Pointer to underlying container
+  constexpr D *Container() const noexcept {
+    return data_;
+  }
+
   /// Dereference operator
-  HandledReturn<D> &operator*() const noexcept {
+  constexpr HandledReturn<D> &operator*() const noexcept {
+    ITERABLE_CHECK(CheckDereference());
     return (*data_)[current_];
   }
 
   /// Member access operator
-  HandledReturn<D> *operator->() const noexcept {
+  constexpr HandledReturn<D> *operator->() const noexcept {
     return std::addressof(operator*());
   }
 
   /// Prefix decrement
-  I &operator--() noexcept {
+  constexpr I &operator--() noexcept {
     current_--; 
     return this->Reference();
   }
 
   /// Postfix decrement
-  I operator--(int) noexcept {
-    auto temp = *this;
+  constexpr I operator--(int) noexcept {
+    I temp = Reference();
     current_--;
-    return temp.Reference();
+    return temp;
   }
 
   /// Addition operator (iterator + n)
-  I operator+(std::ptrdiff_t n) const noexcept {
-    return I(this->data_, this->current_ + n);
+  constexpr I operator+(std::ptrdiff_t n) const noexcept {
+    ITERABLE_CHECK(CheckValid());
+    return I(this->data_, static_cast<N>(this->current_ + n));
   }
 
   /// Subtraction operator (iterator - n)
-  I operator-(std::ptrdiff_t n) const noexcept {
-    return I(this->data_, this->current_ - n);
+  constexpr I operator-(std::ptrdiff_t n) const noexcept {
+    ITERABLE_CHECK(CheckValid());
+    return I(this->data_, static_cast<N>(this->current_ - n));
   }
 
-  /// Difference between iterators
-  std::ptrdiff_t operator-(const IteratorCore &other) const noexcept {
-    return this->current_ - other.current_;
+  /// Difference between iterators (signed, also for unsigned index types)
+  constexpr std::ptrdiff_t operator-(const IteratorCore &other) const noexcept {
+    ITERABLE_CHECK(CheckCompatible(other));
+    return Signed(this->current_) - Signed(other.current_);
+  }
+
+  /// Difference between iterator and sentinel
+  template <std::size_t E>
+  constexpr std::ptrdiff_t operator-(const Sentinel<N, E> &other) const noexcept {
+    return Signed(this->current_) - Signed(other.Length());
+  }
+
+  /// Difference between sentinel and iterator
+  template <std::size_t E>
+  friend constexpr std::ptrdiff_t operator-(const Sentinel<N, E> &lhs, const IteratorCore &rhs) noexcept {
+    return Signed(lhs.Length()) - Signed(rhs.current_);
   }
 
   /// Compound addition assignment
-  I &operator+=(std::ptrdiff_t n) noexcept {
-    this->current_ += n;
+  constexpr I &operator+=(std::ptrdiff_t n) noexcept {
+    this->current_ = static_cast<N>(this->current_ + n);
     return this->Reference();
   }
 
   /// Compound subtraction assignment
-  I &operator-=(std::ptrdiff_t n) noexcept {
-    this->current_ -= n;
+  constexpr I &operator-=(std::ptrdiff_t n) noexcept {
+    this->current_ = static_cast<N>(this->current_ - n);
     return this->Reference();
   }
 
   /// Subscript operator
-  HandledReturn<D> &operator[](std::ptrdiff_t n) const noexcept {
+  constexpr HandledReturn<D> &operator[](std::ptrdiff_t n) const noexcept {
     return *(*this + n);
   }
 
- private:
+ protected:
   D *data_ = nullptr;    ///< Pointer to underlying container
-  int current_ = 0;      ///< Current position index
+  N current_ = 0;        ///< Current position index
+#if ITERABLE_CHECKED
+  std::size_t generation_ = 0; ///< Container generation at construction
+
+  // Abort unless the container is unchanged since the iterator was created
+  constexpr void CheckValid() const noexcept {
+    ITERABLE_ASSERT(generation_ == Generation(data_), "iterator used after its container was invalidated");
+  }
+
+  // Abort unless both iterators are valid and belong to the same container
+  constexpr void CheckCompatible(const IteratorCore &other) const noexcept {
+    ITERABLE_ASSERT(data_ == other.data_, "comparing iterators of different containers");
+    CheckValid();
+    other.CheckValid();
+  }
 
+  // Abort unless the iterator is valid and its index is within the container
+  constexpr void CheckDereference(N index) const noexcept {
+    ITERABLE_ASSERT(data_ != nullptr, "dereferencing a singular iterator");
+    CheckValid();
+    bool in_range = true;
+    if constexpr (std::is_signed_v<N>) {
+      in_range = index >= 0;
+    }
+    if constexpr (Extent<D> != DynamicExtent) {
+      in_range = in_range && static_cast<std::size_t>(index) < Extent<D>;
+    } else if constexpr (HasLength<D>) {
+      in_range = in_range && index < static_cast<N>(data_->Length());
+    }
+    ITERABLE_ASSERT(in_range, "dereferencing an iterator out of range");
+  }
+  constexpr void CheckDereference() const noexcept {
+    CheckDereference(current_);
+  }
+#endif
+
+ private:
   // CRTP helpers
-  I *Pointer() noexcept {
+  constexpr I *Pointer() noexcept {
     return static_cast<I *>(this);
   }
-  const I *Pointer() const noexcept {
+  constexpr const I *Pointer() const noexcept {
     return static_cast<const I *>(this);
   } 
-  I &Reference() noexcept {
+  constexpr I &Reference() noexcept {
     return *Pointer();
   }
-  const I &Reference() const noexcept {
+  constexpr const I &Reference() const noexcept {
     return *Pointer();
   }
 };
 
 /// Global operator for (n + iterator)
-template <typename D, typename I>
-I operator+(std::ptrdiff_t n, const IteratorCore<D, I> &i) {
+template <typename D, typename I, typename N>
+constexpr I operator+(std::ptrdiff_t n, const IteratorCore<D, I, N> &i) {
   return i + n;
 }
 
@@ -217,39 +546,369 @@ I operator+(std::ptrdiff_t n, const IteratorCore<D, I> &i) {
  * 
  * @tparam D Container type
  * @tparam I Concrete iterator type
+ * @tparam N Index type
  */
-template <typename D, typename I>
-struct ContiguousImpl : IteratorCore<D, I> {
-  using IteratorCore<D, I>::IteratorCore;
+template <typename D, typename I, typename N>
+struct ContiguousImpl : IteratorCore<D, I, N> {
+  using IteratorCore<D, I, N>::IteratorCore;
+
+  /// Member access operator (also yields the address of the end, as `std::to_address` requires)
+  constexpr Detail::HandledReturn<D> *operator->() const noexcept {
+    ITERABLE_CHECK(this->CheckValid());
+    // Only ever index existing elements: the end is one past the last one
+    if (this->current_ > 0) {
+      return std::addressof((*this->data_)[this->current_ - 1]) + 1;
+    }
+    if constexpr (HasLength<D>) {
+      if (this->data_->Length() == 0) {
+        return nullptr;
+      }
+    }
+    return std::addressof((*this->data_)[this->current_]);
+  }
 
   /// Conversion to raw pointer
-  operator Detail::HandledReturn<D> *() noexcept {
+  constexpr operator Detail::HandledReturn<D> *() noexcept {
     return this->operator->();
   }
 
   /// Obtain address of current element
-  friend Detail::HandledReturn<D> *to_address(const ContiguousImpl &iterator) noexcept {
+  friend constexpr Detail::HandledReturn<D> *to_address(const ContiguousImpl &iterator) noexcept {
     return iterator;
   }
 };
 #endif
 
+/**
+ * @brief Specialization for proxy iterators.
+ *
+ * Dereferencing returns the result of `operator[]` unchanged, so containers
+ * producing values or proxy references (bit-packed, encoded, SoA storage)
+ * are iterated in place.
+ * 
+ * @tparam D Container type
+ * @tparam I Concrete iterator type
+ * @tparam N Index type
+ */
+template <typename D, typename I, typename N>
+struct ProxyImpl : IteratorCore<D, I, N> {
+  using IteratorCore<D, I, N>::IteratorCore;
+
+  /// Dereference operator
+  constexpr OperatorReturn<D> operator*() const {
+    ITERABLE_CHECK(this->CheckDereference());
+    return (*this->data_)[this->current_];
+  }
+
+  /// Subscript operator
+  constexpr OperatorReturn<D> operator[](std::ptrdiff_t n) const {
+    return *(*this + n);
+  }
+};
+
+/**
+ * @brief Specialization for strided iterators.
+ *
+ * The index counts strided elements; dereferencing accesses
+ * `operator[](index * Stride())`. A runtime stride is read once on
+ * construction, a `static constexpr Stride()` is folded into the access.
+ * 
+ * @tparam D Container type
+ * @tparam I Concrete iterator type
+ * @tparam N Index type
+ * @tparam S Whether the stride is a compile-time constant
+ */
+template <typename D, typename I, typename N, bool S = StaticStride<D>>
+struct StridedImpl : IteratorCore<D, I, N> {
+  /// Default constructor
+  StridedImpl() = default;
+
+  /**
+   * @brief Construct with container pointer and index.
+   * 
+   * @param data Pointer to container
+   * @param current Starting index (in strided elements)
+   */
+  constexpr StridedImpl(D *data, N current) 
+    : IteratorCore<D, I, N>(data, current), stride_(static_cast<N>(data->Stride())) {}
+
+  /// Dereference operator
+  constexpr HandledReturn<D> &operator*() const noexcept {
+    ITERABLE_CHECK(this->CheckDereference());
+    return (*this->data_)[this->current_ * stride_];
+  }
+
+  /// Member access operator
+  constexpr HandledReturn<D> *operator->() const noexcept {
+    return std::addressof(operator*());
+  }
+
+ private:
+  N stride_ = 0; ///< Distance between consecutive elements
+};
+
+template <typename D, typename I, typename N>
+struct StridedImpl<D, I, N, true> : IteratorCore<D, I, N> {
+  using IteratorCore<D, I, N>::IteratorCore;
+
+  /// Dereference operator
+  constexpr HandledReturn<D> &operator*() const noexcept {
+    ITERABLE_CHECK(this->CheckDereference());
+    return (*this->data_)[this->current_ * static_cast<N>(std::remove_const_t<D>::Stride())];
+  }
+
+  /// Member access operator
+  constexpr HandledReturn<D> *operator->() const noexcept {
+    return std::addressof(operator*());
+  }
+};
+
+/**
+ * @brief Implementation for segmented iterators.
+ *
+ * The container provides `SegmentCount()` and `Segment(index)` returning a
+ * range of element pointers (e.g. `Range<T *>`). The iterator bumps a pointer
+ * within a segment and only consults the container when crossing into the
+ * next non-empty segment. The index is the segment index; the end iterator
+ * is positioned at `SegmentCount()`.
+ *
+ * @tparam D Container type
+ * @tparam I Concrete iterator type (CRTP)
+ * @tparam N Index type
+ */
+template <typename D, typename I, typename N>
+class SegmentedImpl {
+ public:
+  using Element = SegmentElement<D>; ///< Element type
+
+  /// Default constructor
+  SegmentedImpl() = default;
+
+  /**
+   * @brief Construct at the first element of a segment.
+   * 
+   * Empty segments are skipped; `segment == SegmentCount()` yields the end.
+   *
+   * @param data Pointer to container
+   * @param segment Segment index
+   */
+  constexpr SegmentedImpl(D *data, N segment) 
+    : data_(data), segment_(segment) {
+    Enter();
+  }
+
+  /// Dereference operator
+  constexpr Element &operator*() const noexcept {
+    ITERABLE_ASSERT(current_ != nullptr, "dereferencing the end iterator");
+    return *current_;
+  }
+
+  /// Member access operator
+  constexpr Element *operator->() const noexcept {
+    ITERABLE_ASSERT(current_ != nullptr, "dereferencing the end iterator");
+    return current_;
+  }
+
+  /// Prefix increment
+  constexpr I &operator++() noexcept {
+    if (++current_ == last_) {
+      segment_++;
+      Enter();
+    }
+    return static_cast<I &>(*this);
+  }
+
+  /// Postfix increment
+  constexpr I operator++(int) noexcept {
+    I temp = static_cast<I &>(*this);
+    ++*this;
+    return temp;
+  }
+
+  // Comparison operators
+  constexpr bool operator==(const SegmentedImpl &other) const noexcept {
+    ITERABLE_ASSERT(data_ == other.data_, "comparing iterators of different containers");
+    return current_ == other.current_;
+  }
+  constexpr bool operator!=(const SegmentedImpl &other) const noexcept {
+    ITERABLE_ASSERT(data_ == other.data_, "comparing iterators of different containers");
+    return current_ != other.current_;
+  }
+
+  /// Pointer to underlying container
+  constexpr D *Container() const noexcept {
+    return data_;
+  }
+
+  /// Index of the current segment
+  constexpr N SegmentIndex() const noexcept {
+    return segment_;
+  }
+
+  /// Pointer to the current element (null at the end)
+  constexpr Element *Position() const noexcept {
+    return current_;
+  }
+
+  /// Pointer one past the last element of the current segment
+  constexpr Element *SegmentEnd() const noexcept {
+    return last_;
+  }
+
+ protected:
+  D *data_ = nullptr;          ///< Pointer to underlying container
+  N segment_ = 0;              ///< Current segment index
+  Element *current_ = nullptr; ///< Current element
+  Element *last_ = nullptr;    ///< End of the current segment
+
+ private:
+  // Move to the first element of the next non-empty segment, or the end
+  constexpr void Enter() noexcept {
+    for (auto count = static_cast<N>(data_->SegmentCount()); segment_ < count; segment_++) {
+      auto segment = data_->Segment(static_cast<std::size_t>(segment_));
+      if (segment.begin() != segment.end()) {
+        current_ = segment.begin();
+        last_ = segment.end();
+        return;
+      }
+    }
+    current_ = last_ = nullptr;
+  }
+};
+
+/**
+ * @brief Implementation for single-pass input iterators.
+ *
+ * The producer provides `Done()`, true once no element remains, and `Next()`,
+ * returning the next element. The current element is held by the iterator:
+ * by pointer when `Next()` returns an lvalue reference, by value otherwise.
+ * The end of the range is `ViewEnd`.
+ *
+ * @tparam D Producer type
+ * @tparam I Concrete iterator type (CRTP)
+ * @tparam N Index type (unused)
+ */
+template <typename D, typename I, typename N>
+class InputImpl {
+  static constexpr bool ByReference = std::is_lvalue_reference_v<NextReturn<D>>;
+
+ public:
+  using Element = std::remove_reference_t<NextReturn<D>>; ///< Element type
+
+  /// Default constructor
+  InputImpl() = default;
+
+  /**
+   * @brief Construct at the first element produced by `data`.
+   *
+   * @param data Pointer to producer
+   */
+  explicit InputImpl(D *data) 
+    : data_(data) {
+    Advance();
+  }
+
+  /// Dereference operator
+  Element &operator*() const noexcept {
+    ITERABLE_ASSERT(!done_, "dereferencing an exhausted input iterator");
+    return *current_;
+  }
+
+  /// Member access operator
+  Element *operator->() const noexcept {
+    return std::addressof(operator*());
+  }
+
+  /// Prefix increment
+  I &operator++() {
+    ITERABLE_ASSERT(!done_, "incrementing an exhausted input iterator");
+    Advance();
+    return static_cast<I &>(*this);
+  }
+
+  /// Postfix increment (the copy keeps the previous element)
+  I operator++(int) {
+    I temp = static_cast<I &>(*this);
+    Advance();
+    return temp;
+  }
+
+  /// Checks whether the producer was exhausted
+  bool Done() const noexcept {
+    return done_;
+  }
+
+  // Sentinel comparison operators
+  friend bool operator==(const InputImpl &lhs, ViewEnd) noexcept {
+    return lhs.done_;
+  }
+  friend bool operator!=(const InputImpl &lhs, ViewEnd) noexcept {
+    return !lhs.done_;
+  }
+  friend bool operator==(ViewEnd, const InputImpl &rhs) noexcept {
+    return rhs.done_;
+  }
+  friend bool operator!=(ViewEnd, const InputImpl &rhs) noexcept {
+    return !rhs.done_;
+  }
+
+ protected:
+  using Storage = std::conditional_t<ByReference, Element *, std::optional<std::decay_t<Element>>>;
+
+  D *data_ = nullptr;         ///< Pointer to producer
+  mutable Storage current_{}; ///< Current element
+  bool done_ = true;          ///< Whether the producer is exhausted
+
+ private:
+  void Advance() {
+    done_ = data_->Done();
+    if (done_) {
+      return;
+    }
+    if constexpr (ByReference) {
+      current_ = std::addressof(data_->Next());
+    } else {
+      current_.emplace(data_->Next());
+    }
+  }
+};
+
 // Select implementation based on tag
-template <typename D, typename I, Tag T>
+template <typename D, typename I, typename N, Tag T>
 struct SelectImplS {
-  using Type = IteratorCore<D, I>; ///< Default implementation
+  using Type = IteratorCore<D, I, N>; ///< Default implementation
+};
+
+template <typename D, typename I, typename N>
+struct SelectImplS<D, I, N, Tag::Proxy> {
+  using Type = ProxyImpl<D, I, N>; ///< Proxy implementation
+};
+
+template <typename D, typename I, typename N>
+struct SelectImplS<D, I, N, Tag::Strided> {
+  using Type = StridedImpl<D, I, N>; ///< Strided implementation
+};
+
+template <typename D, typename I, typename N>
+struct SelectImplS<D, I, N, Tag::Segmented> {
+  using Type = SegmentedImpl<D, I, N>; ///< Segmented implementation
+};
+
+template <typename D, typename I, typename N>
+struct SelectImplS<D, I, N, Tag::Input> {
+  using Type = InputImpl<D, I, N>; ///< Input implementation
 };
 
 #if ITERABLE_CPP_20
-template <typename D, typename I>
-struct SelectImplS<D, I, Tag::Contiguous> {
-  using Type = ContiguousImpl<D, I>; ///< C++20 contiguous implementation
+template <typename D, typename I, typename N>
+struct SelectImplS<D, I, N, Tag::Contiguous> {
+  using Type = ContiguousImpl<D, I, N>; ///< C++20 contiguous implementation
 };
 #endif
 
 /// Alias for selected implementation type
-template <typename D, typename I, Tag T>
-using SelectImpl = typename SelectImplS<D, I, T>::Type;
+template <typename D, typename I, typename N, Tag T>
+using SelectImpl = typename SelectImplS<D, I, N, T>::Type;
 
 } // namespace Detail
 
@@ -259,14 +918,160 @@ using SelectImpl = typename SelectImplS<D, I, T>::Type;
  * Provides standard-compliant iterator using CRTP. Supports:
  * - Random access (default)
  * - Contiguous memory (C++20)
+ * - Proxy references or values returned by `operator[]`
+ * - Strided access through `Stride()`
+ * - Segmented (forward) traversal through `Segment()`
+ * - Single-pass input through `Next()`/`Done()`
+ *
+ * The index type defaults to the return type of `D::Length()`, or
+ * `std::ptrdiff_t` when the container has none, so containers with more
+ * than 2^31 elements iterate without truncation.
  *
  * @tparam D Container type (must implement `operator[]`)
  * @tparam T Iterator category tag (default: Tag::Default)
+ * @tparam N Index type (default: deduced from `D::Length()`)
  */
-template <typename D, Tag T = Default>
+template <typename D, Tag T = Default, typename N = Detail::Index<D>>
 struct Iterator 
-: Detail::SelectImpl<D, Iterator<D, T>, T>, Detail::IteratorCompat<D, T> {
-  using Impl = Detail::SelectImpl<D, Iterator, T>; ///< Selected implementation
+: Detail::SelectImpl<D, Iterator<D, T, N>, N, T>, Detail::IteratorCompat<D, T> {
+  using Impl = Detail::SelectImpl<D, Iterator, N, T>; ///< Selected implementation
   using Impl::Impl; ///< Inherit constructors
 };
+
+/**
+ * @brief Reverse iterator positioned directly on its element.
+ *
+ * Unlike `std::reverse_iterator`, which dereferences `std::prev(base)`, this
+ * adapter holds the iterator to the current element, so dereferencing does
+ * not step back first. The reverse end is the position before the first
+ * element, so `I` must allow stepping there (index-based `Iterator` does;
+ * raw pointers do not).
+ *
+ * @tparam I Underlying random access iterator type
+ */
+template <typename I>
+class ReverseIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;                 ///< Iterator category tag
+#if ITERABLE_CPP_20
+  using iterator_concept  = std::random_access_iterator_tag;                 ///< Iterator concept tag
+#endif
+  using difference_type   = typename std::iterator_traits<I>::difference_type; ///< Difference type
+  using value_type        = typename std::iterator_traits<I>::value_type;    ///< Value type
+  using pointer           = typename std::iterator_traits<I>::pointer;       ///< Pointer type
+  using reference         = typename std::iterator_traits<I>::reference;     ///< Reference type
+
+  /// Default constructor
+  ReverseIterator() = default;
+
+  /**
+   * @brief Construct positioned on an element.
+   * 
+   * @param current Iterator to the current element
+   */
+  constexpr explicit ReverseIterator(I current) 
+    : current_(current) {}
+
+  /// Iterator one past the current element, as `std::reverse_iterator::base()`
+  constexpr I Base() const {
+    return std::next(current_);
+  }
+
+  /// Dereference operator
+  constexpr reference operator*() const {
+    return *current_;
+  }
+
+  /// Member access operator
+  constexpr auto operator->() const {
+    return current_.operator->();
+  }
+
+  /// Subscript operator
+  constexpr reference operator[](difference_type n) const {
+    return current_[-n];
+  }
+
+  /// Prefix increment
+  constexpr ReverseIterator &operator++() {
+    --current_;
+    return *this;
+  }
+
+  /// Postfix increment
+  constexpr ReverseIterator operator++(int) {
+    auto temp = *this;
+    --current_;
+    return temp;
+  }
+
+  /// Prefix decrement
+  constexpr ReverseIterator &operator--() {
+    ++current_;
+    return *this;
+  }
+
+  /// Postfix decrement
+  constexpr ReverseIterator operator--(int) {
+    auto temp = *this;
+    ++current_;
+    return temp;
+  }
+
+  /// Addition operator (iterator + n)
+  constexpr ReverseIterator operator+(difference_type n) const {
+    return ReverseIterator(current_ - n);
+  }
+
+  /// Global operator for (n + iterator)
+  friend constexpr ReverseIterator operator+(difference_type n, const ReverseIterator &i) {
+    return i + n;
+  }
+
+  /// Subtraction operator (iterator - n)
+  constexpr ReverseIterator operator-(difference_type n) const {
+    return ReverseIterator(current_ + n);
+  }
+
+  /// Difference between iterators
+  constexpr difference_type operator-(const ReverseIterator &other) const {
+    return other.current_ - current_;
+  }
+
+  /// Compound addition assignment
+  constexpr ReverseIterator &operator+=(difference_type n) {
+    current_ -= n;
+    return *this;
+  }
+
+  /// Compound subtraction assignment
+  constexpr ReverseIterator &operator-=(difference_type n) {
+    current_ += n;
+    return *this;
+  }
+
+  // Comparison operators (ordered through the difference, so an index that
+  // wrapped below zero at the reverse end still compares correctly)
+  constexpr bool operator==(const ReverseIterator &other) const {
+    return current_ == other.current_;
+  }
+  constexpr bool operator!=(const ReverseIterator &other) const {
+    return current_ != other.current_;
+  }
+  constexpr bool operator<(const ReverseIterator &other) const {
+    return other - *this > 0;
+  }
+  constexpr bool operator>(const ReverseIterator &other) const {
+    return other < *this;
+  }
+  constexpr bool operator<=(const ReverseIterator &other) const {
+    return !(other < *this);
+  }
+  constexpr bool operator>=(const ReverseIterator &other) const {
+    return !(*this < other);
+  }
+
+ private:
+  I current_{}; ///< Iterator to the current element
+};
 } // namespace Iterable
@@ -0,0 +1,160 @@
+/**
+ * @file
+ * @brief Provides a read-only, memory-mapped array of fixed-size records (POSIX).
+ */
+#pragma once
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "iterable/mapped.h requires a POSIX platform"
+#endif
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <iterable/iterable.h>
+
+namespace Iterable {
+/**
+ * @brief Expected access pattern, forwarded to `madvise`.
+ */
+enum Access {
+  Normal,     ///< No particular pattern
+  Sequential, ///< Linear scans; the kernel reads ahead aggressively
+  Random,     ///< Point lookups; read-ahead is disabled
+  WillNeed,   ///< Whole mapping is about to be used; start paging it in
+};
+
+/**
+ * @brief Fixed-size records of a binary file, mapped into memory.
+ *
+ * The file is mapped read-only and iterated through raw pointers (via
+ * `Tag::Contiguous` and `Data()`), so nothing is parsed or copied. A trailing
+ * partial record is ignored. Hints passed to `Advise()` are best-effort.
+ *
+ * @tparam T Record type (trivially copyable)
+ */
+template <typename T>
+class MappedArray : public For<MappedArray<T>, Tag::Contiguous> {
+  static_assert(std::is_trivially_copyable_v<T>, "Mapped records must be trivially copyable");
+
+ public:
+  /// Default constructor (empty mapping)
+  MappedArray() = default;
+
+  /**
+   * @brief Map the file at `path`.
+   *
+   * @param path File to map
+   * @param access Initial access pattern hint
+   * @param huge_pages Request transparent huge pages where supported
+   * @throws std::system_error If the file cannot be opened, inspected or mapped
+   */
+  explicit MappedArray(const std::string &path, Access access = Sequential, bool huge_pages = false) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(), "open " + path);
+    }
+    struct stat status {};
+    if (::fstat(fd, &status) != 0) {
+      int error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(), "fstat " + path);
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ != 0) {
+      void *address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (address == MAP_FAILED) {
+        int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "mmap " + path);
+      }
+      records_ = static_cast<const T *>(address);
+    }
+    ::close(fd);
+
+    if (huge_pages) {
+#ifdef MADV_HUGEPAGE
+      ::madvise(Address(), size_, MADV_HUGEPAGE);
+#endif
+    }
+    Advise(access);
+  }
+
+  /// Unmaps the file
+  ~MappedArray() {
+    Unmap();
+  }
+
+  MappedArray(const MappedArray &other) = delete;
+  MappedArray &operator=(const MappedArray &other) = delete;
+
+  /// Move constructor
+  MappedArray(MappedArray &&other) noexcept
+    : records_(std::exchange(other.records_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+  /// Move assignment
+  MappedArray &operator=(MappedArray &&other) noexcept {
+    if (this != &other) {
+      Unmap();
+      records_ = std::exchange(other.records_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Change the access pattern hint for the whole mapping.
+   *
+   * @param access Expected access pattern
+   */
+  void Advise(Access access) const noexcept {
+    if (size_ == 0) {
+      return;
+    }
+    switch (access) {
+      case Normal:     ::posix_madvise(Address(), size_, POSIX_MADV_NORMAL);     break;
+      case Sequential: ::posix_madvise(Address(), size_, POSIX_MADV_SEQUENTIAL); break;
+      case Random:     ::posix_madvise(Address(), size_, POSIX_MADV_RANDOM);     break;
+      case WillNeed:   ::posix_madvise(Address(), size_, POSIX_MADV_WILLNEED);   break;
+    }
+  }
+
+  /// Record access
+  const T &operator[](std::size_t index) const noexcept {
+    return records_[index];
+  }
+
+  /// Number of complete records
+  std::size_t Length() const noexcept {
+    return size_ / sizeof(T);
+  }
+
+  /// Pointer to the first record
+  const T *Data() const noexcept {
+    return records_;
+  }
+
+ private:
+  const T *records_ = nullptr; ///< Start of the mapping
+  std::size_t size_ = 0;       ///< Mapped size in bytes
+
+  void *Address() const noexcept {
+    return const_cast<void *>(static_cast<const void *>(records_));
+  }
+
+  void Unmap() noexcept {
+    if (records_ != nullptr) {
+      ::munmap(Address(), size_);
+      records_ = nullptr;
+      size_ = 0;
+    }
+  }
+};
+} // namespace Iterable
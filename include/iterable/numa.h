@@ -0,0 +1,501 @@
+/**
+ * @file
+ * @brief Provides NUMA-aware parallel iteration: a pool of workers pinned to
+ * the CPUs of each node and ranges partitioned by node.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterable/check.h>
+#include <iterable/define.h>
+#include <iterable/parallel.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace Iterable {
+namespace Detail {
+
+// CPUs of a Linux cpulist such as "0-3,8-11"
+inline std::vector<unsigned> ParseCpuList(const std::string &list) {
+  std::vector<unsigned> cpus;
+  unsigned first = 0;
+  unsigned value = 0;
+  bool digits = false;
+  bool range = false;
+  for (char c : list + ",") {
+    if (c >= '0' && c <= '9') {
+      value = value * 10 + static_cast<unsigned>(c - '0');
+      digits = true;
+    } else if (c == '-') {
+      first = value;
+      value = 0;
+      range = true;
+    } else if (c == ',') {
+      if (digits) {
+        for (auto cpu = range ? first : value; cpu <= value; cpu++) {
+          cpus.push_back(cpu);
+        }
+      }
+      value = 0;
+      digits = false;
+      range = false;
+    }
+  }
+  return cpus;
+}
+
+// Restrict the calling thread to `cpus`; false if unsupported or refused
+inline bool PinThread(const std::vector<unsigned> &cpus) noexcept {
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (auto cpu : cpus) {
+    if (cpu < CPU_SETSIZE) {
+      CPU_SET(cpu, &set);
+    }
+  }
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  static_cast<void>(cpus);
+  return false;
+#endif
+}
+
+// CPUs the calling thread may run on, from its affinity mask on Linux, or
+// `0..DefaultConcurrency() - 1` if unknown
+inline std::vector<unsigned> AllowedCpus() {
+  std::vector<unsigned> cpus;
+#if defined(__linux__)
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+    for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &allowed)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  if (cpus.empty()) {
+    for (unsigned cpu = 0; cpu < ThreadPool::DefaultConcurrency(); cpu++) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+// Pins the calling thread for the lifetime of the scope, then restores its affinity
+class PinScope {
+ public:
+  explicit PinScope(const std::vector<unsigned> &cpus) noexcept {
+#if defined(__linux__)
+    saved_ = sched_getaffinity(0, sizeof(previous_), &previous_) == 0 && PinThread(cpus);
+#else
+    static_cast<void>(cpus);
+#endif
+  }
+
+  ~PinScope() {
+#if defined(__linux__)
+    if (saved_) {
+      sched_setaffinity(0, sizeof(previous_), &previous_);
+    }
+#endif
+  }
+
+  PinScope(const PinScope &other) = delete;
+  PinScope &operator=(const PinScope &other) = delete;
+
+ private:
+#if defined(__linux__)
+  cpu_set_t previous_; // Affinity before the scope
+  bool saved_ = false; // Whether the affinity is restored on exit
+#endif
+};
+
+} // namespace Detail
+
+/**
+ * @brief NUMA nodes of the host and the CPUs of each.
+ *
+ * Nodes are numbered from zero in the order of the system's node ids, and
+ * only hold the CPUs the process may run on, nodes without such CPUs being
+ * dropped. Without NUMA information (or off Linux) the host is one node of
+ * the CPUs in the process affinity mask, or of
+ * `ThreadPool::DefaultConcurrency()` CPUs where no mask is available.
+ */
+class Topology {
+ public:
+  /**
+   * @brief Construct from the CPUs of each node.
+   *
+   * @param nodes CPU numbers of each node (empty nodes are dropped; none: the allowed CPUs)
+   */
+  explicit Topology(std::vector<std::vector<unsigned>> nodes) {
+    for (auto &cpus : nodes) {
+      if (!cpus.empty()) {
+        nodes_.push_back(std::move(cpus));
+      }
+    }
+    if (nodes_.empty()) {
+      nodes_.push_back(Detail::AllowedCpus());
+    }
+  }
+
+  /**
+   * @brief Topology of the host, read from `/sys/devices/system/node` on Linux.
+   */
+  static Topology Detect() {
+    std::vector<std::vector<unsigned>> nodes;
+#if defined(__linux__)
+    auto allowed = Detail::AllowedCpus();
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+    std::getline(online, list);
+    for (auto node : Detail::ParseCpuList(list)) {
+      std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+      std::string cpus;
+      std::getline(file, cpus);
+      nodes.emplace_back();
+      for (auto cpu : Detail::ParseCpuList(cpus)) {
+        if (std::binary_search(allowed.begin(), allowed.end(), cpu)) {
+          nodes.back().push_back(cpu);
+        }
+      }
+    }
+#endif
+    return Topology(std::move(nodes));
+  }
+
+  /// Number of nodes (at least one)
+  unsigned NodeCount() const noexcept {
+    return static_cast<unsigned>(nodes_.size());
+  }
+
+  /// CPUs of `node`
+  const std::vector<unsigned> &Cpus(unsigned node) const {
+    return nodes_[node];
+  }
+
+  /// Number of CPUs over all nodes
+  unsigned CpuCount() const noexcept {
+    std::size_t count = 0;
+    for (auto &cpus : nodes_) {
+      count += cpus.size();
+    }
+    return static_cast<unsigned>(count);
+  }
+
+ private:
+  std::vector<std::vector<unsigned>> nodes_; ///< CPUs of each node
+};
+
+/**
+ * @brief Thread pool whose workers are pinned to the CPUs of their node.
+ *
+ * Workers are assigned to nodes in proportion to their CPUs, in blocks of
+ * consecutive indices, and each worker thread is restricted to the CPUs of its
+ * node, where the memory it touches first is then allocated. The calling
+ * thread of `Run()` (worker 0) is pinned for the duration of the call only.
+ * Pinning uses `sched_setaffinity` on Linux; elsewhere workers are not pinned
+ * and `Pinned()` is false.
+ *
+ * A `NumaPool` is an executor for `ParallelFor`, `ParallelSort` and
+ * `ParallelReduce`, and the executor of `NumaFor` and `FirstTouch`.
+ */
+class NumaPool {
+  struct alignas(64) Cursor {
+    std::atomic<std::ptrdiff_t> next{0};
+  };
+
+ public:
+  /**
+   * @brief Construct a pool of `concurrency` workers over `topology`.
+   *
+   * @param topology Nodes and their CPUs (default: detected)
+   * @param concurrency Number of threads (0: one per CPU of `topology`)
+   */
+  explicit NumaPool(Topology topology = Topology::Detect(), unsigned concurrency = 0)
+    : topology_(std::move(topology)),
+      pool_(concurrency != 0 ? concurrency : topology_.CpuCount()),
+      nodes_(pool_.Concurrency()),
+      workers_(topology_.NodeCount(), 0) {
+    unsigned cpus = topology_.CpuCount();
+    unsigned node = 0;
+    unsigned below = 0;
+    for (unsigned worker = 0; worker < pool_.Concurrency(); worker++) {
+      auto position = static_cast<unsigned>(std::size_t(worker) * cpus / pool_.Concurrency());
+      while (position >= below + static_cast<unsigned>(topology_.Cpus(node).size())) {
+        below += static_cast<unsigned>(topology_.Cpus(node++).size());
+      }
+      nodes_[worker] = node;
+      workers_[node]++;
+    }
+    std::atomic<bool> pinned{pool_.Concurrency() > 1};
+    pool_.Run([&](unsigned worker) {
+      if (worker != 0 && !Detail::PinThread(topology_.Cpus(nodes_[worker]))) {
+        pinned.store(false, std::memory_order_relaxed);
+      }
+    });
+    pinned_ = pinned.load();
+  }
+
+  NumaPool(const NumaPool &other) = delete;
+  NumaPool &operator=(const NumaPool &other) = delete;
+
+  /// Number of threads taking part in `Run()`
+  unsigned Concurrency() const noexcept {
+    return pool_.Concurrency();
+  }
+
+  /**
+   * @brief Invoke `task(worker)` once per worker and wait for completion.
+   *
+   * Same semantics as `ThreadPool::Run()`, with each worker on its node.
+   *
+   * @param task Callable taking the worker index
+   */
+  template <typename F>
+  void Run(F &&task) {
+    pool_.Run([&](unsigned worker) {
+      if (worker == 0 && pinned_) {
+        Detail::PinScope scope(topology_.Cpus(nodes_[0]));
+        task(worker);
+      } else {
+        task(worker);
+      }
+    });
+  }
+
+  /// Number of nodes
+  unsigned NodeCount() const noexcept {
+    return topology_.NodeCount();
+  }
+
+  /// Node of `worker`
+  unsigned Node(unsigned worker) const {
+    return nodes_[worker];
+  }
+
+  /// Number of workers on `node` (zero with fewer workers than nodes)
+  unsigned NodeWorkers(unsigned node) const {
+    return workers_[node];
+  }
+
+  /// CPUs of `node`
+  const std::vector<unsigned> &Cpus(unsigned node) const {
+    return topology_.Cpus(node);
+  }
+
+  /// Whether the worker threads could be pinned to their nodes (false with one worker)
+  bool Pinned() const noexcept {
+    return pinned_;
+  }
+
+  /**
+   * @brief Apply `fn` to the elements `[first + bounds[n], first + bounds[n + 1])`
+   * of each node `n` on the workers of that node.
+   *
+   * Workers claim ranges of `grain` elements of their node's partition, then,
+   * with `steal`, of the other nodes' partitions, so faster nodes take over the
+   * end of slower ones. Without `steal`, only the partitions of nodes without
+   * workers are shared.
+   *
+   * @param first Random access iterator to the first element
+   * @param bounds `NodeCount() + 1` ascending offsets from `first`
+   * @param fn Callable invoked with each element
+   * @param grain Elements per claimed range
+   * @param steal Whether workers continue on other nodes' partitions
+   */
+  template <typename I, typename F>
+  void Partitioned(I first, const std::vector<std::ptrdiff_t> &bounds, F &fn, std::ptrdiff_t grain, bool steal) {
+    ITERABLE_ASSERT(bounds.size() == NodeCount() + 1, "one partition per node required");
+    auto data = Detail::Unwrap(first);
+    unsigned count = NodeCount();
+    std::vector<Cursor> cursors(count);
+    Run([&](unsigned worker) {
+      auto home = nodes_[worker];
+      for (unsigned step = 0; step < count; step++) {
+        auto node = (home + step) % count;
+        if (step != 0 && !steal && workers_[node] != 0) {
+          continue;
+        }
+        auto length = bounds[node + 1] - bounds[node];
+        auto begin = data + bounds[node];
+        for (auto offset = cursors[node].next.fetch_add(grain, std::memory_order_relaxed); offset < length;
+                  offset = cursors[node].next.fetch_add(grain, std::memory_order_relaxed)) {
+          std::for_each(begin + offset, begin + std::min(offset + grain, length), fn);
+        }
+      }
+    });
+  }
+
+ private:
+  Topology topology_;             ///< Nodes and their CPUs
+  ThreadPool pool_;               ///< Worker threads
+  std::vector<unsigned> nodes_;   ///< Node of each worker
+  std::vector<unsigned> workers_; ///< Number of workers of each node
+  bool pinned_ = false;           ///< Whether the workers are pinned
+
+};
+
+/// Process-wide NUMA pool over the detected topology
+inline NumaPool &DefaultNumaPool() {
+  static NumaPool pool;
+  return pool;
+}
+
+namespace Detail {
+
+// Offset of the first element of `node`, from the container's
+// `NodeBoundary(node, nodes)` placement hint if it has one, or an even split
+template <typename C, typename = std::void_t<>>
+struct PlacementS {
+  static std::ptrdiff_t Boundary(const C &, std::ptrdiff_t length, unsigned node, unsigned nodes) noexcept {
+    return Share(length, node, nodes);
+  }
+};
+template <typename C>
+struct PlacementS<C, std::void_t<decltype(std::declval<const C &>().NodeBoundary(0u, 1u))>> {
+  static std::ptrdiff_t Boundary(const C &container, std::ptrdiff_t length, unsigned node, unsigned nodes) {
+    return node == nodes ? length : static_cast<std::ptrdiff_t>(container.NodeBoundary(node, nodes));
+  }
+};
+
+// Per-node offsets of `length` elements of `container`
+template <typename C>
+std::vector<std::ptrdiff_t> NodeBounds(const C *container, std::ptrdiff_t length, unsigned nodes) {
+  std::vector<std::ptrdiff_t> bounds(nodes + 1);
+  for (unsigned node = 0; node <= nodes; node++) {
+    if constexpr (std::is_void_v<C>) {
+      bounds[node] = Share(length, node, nodes);
+    } else {
+      bounds[node] = PlacementS<C>::Boundary(*container, length, node, nodes);
+    }
+    ITERABLE_ASSERT(node == 0 ? bounds[0] == 0 : bounds[node - 1] <= bounds[node] && bounds[node] <= length,
+                    "node boundaries must ascend from 0 to the length");
+  }
+  return bounds;
+}
+
+} // namespace Detail
+
+/**
+ * @brief Apply `fn` to every element of `[first, last)` in parallel, each node
+ * processing one equal share of the range.
+ *
+ * The shares match those written by `FirstTouch()`, so after first-touch
+ * initialization every worker starts on memory of its own node. Workers then
+ * help the other nodes finish (see `NumaPool::Partitioned()`).
+ *
+ * @param first Random access iterator to the first element
+ * @param last Iterator one past the last element
+ * @param fn Callable invoked with each element
+ * @param grain Elements per claimed range (0: chosen from length and concurrency)
+ * @param pool Pool running the workers
+ */
+template <typename I, typename F>
+void NumaFor(I first, I last, F fn, std::ptrdiff_t grain, NumaPool &pool) {
+  static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+    typename std::iterator_traits<I>::iterator_category>,
+    "NumaFor requires random access iterators");
+
+  std::ptrdiff_t length = last - first;
+  if (length <= 0) {
+    return;
+  }
+  if (grain <= 0) {
+    grain = Detail::DefaultGrain(length, pool.Concurrency());
+  }
+  pool.Partitioned(first, Detail::NodeBounds<void>(nullptr, length, pool.NodeCount()), fn, grain, true);
+}
+
+/**
+ * @brief Apply `fn` to every element of `[first, last)` on the default NUMA pool.
+ */
+template <typename I, typename F>
+void NumaFor(I first, I last, F fn, std::ptrdiff_t grain = 0) {
+  NumaFor(first, last, std::move(fn), grain, DefaultNumaPool());
+}
+
+/**
+ * @brief Apply `fn` to every element of a container in parallel, each node
+ * processing the elements placed in its memory.
+ *
+ * A container whose elements are placed by node declares the placement hint
+ * `NodeBoundary(node, nodes)`, the index of its first element on `node` when
+ * spread over `nodes` nodes (ascending, from zero for node zero). Otherwise
+ * the range is split evenly like `FirstTouch()` does.
+ *
+ * @param container Random access range providing `begin()` and `end()`
+ * @param fn Callable invoked with each element
+ * @param grain Elements per claimed range (0: chosen from length and concurrency)
+ * @param pool Pool running the workers
+ */
+template <typename C, typename F>
+void NumaFor(C &container, F fn, std::ptrdiff_t grain, NumaPool &pool) {
+  auto first = container.begin();
+  std::ptrdiff_t length = container.end() - first;
+  if (length <= 0) {
+    return;
+  }
+  if (grain <= 0) {
+    grain = Detail::DefaultGrain(length, pool.Concurrency());
+  }
+  using Placement = std::remove_const_t<C>;
+  pool.Partitioned(first, Detail::NodeBounds<Placement>(&container, length, pool.NodeCount()), fn, grain, true);
+}
+
+/**
+ * @brief Apply `fn` to every element of a container on the default NUMA pool.
+ */
+template <typename C, typename F>
+void NumaFor(C &container, F fn, std::ptrdiff_t grain = 0) {
+  NumaFor(container, std::move(fn), grain, DefaultNumaPool());
+}
+
+/**
+ * @brief Initialize `[first, last)` with `init` so that each node's share of
+ * the range is first written by the workers of that node.
+ *
+ * Operating systems commonly allocate a page on the node of the thread that
+ * first writes it (Linux by default), so the pages must not be resident yet:
+ * e.g. a large `new T[n]` of a trivial type, which allocators serve with
+ * freshly mapped pages. Recycled heap memory (small allocations, `Arena`
+ * blocks) is usually resident already, and a `std::vector` constructor
+ * writes every element. Workers never write another node's share, and the
+ * shares match those `NumaFor()` visits first.
+ *
+ * @param first Random access iterator to the first element
+ * @param last Iterator one past the last element
+ * @param init Callable invoked with each element
+ * @param pool Pool running the workers
+ */
+template <typename I, typename F>
+void FirstTouch(I first, I last, F init, NumaPool &pool) {
+  std::ptrdiff_t length = last - first;
+  if (length <= 0) {
+    return;
+  }
+  auto grain = Detail::DefaultGrain(length, pool.Concurrency());
+  pool.Partitioned(first, Detail::NodeBounds<void>(nullptr, length, pool.NodeCount()), init, grain, false);
+}
+
+/**
+ * @brief Initialize `[first, last)` with `init` on the default NUMA pool.
+ */
+template <typename I, typename F>
+void FirstTouch(I first, I last, F init) {
+  FirstTouch(first, last, std::move(init), DefaultNumaPool());
+}
+} // namespace Iterable
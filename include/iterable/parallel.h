@@ -0,0 +1,484 @@
+/**
+ * @file
+ * @brief Provides a thread pool and parallel iteration, sorting and reduction
+ * over random access ranges.
+ *
+ * Not included by `iterable/iterable.h`: the overloads taking a container
+ * work on any `For` type (or range with `begin()` and `end()` members), and
+ * using them requires linking `iterable::parallel`, which adds the thread
+ * library.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterable/define.h>
+
+#if ITERABLE_CPP_20
+#include <memory>
+#endif
+
+namespace Iterable {
+/**
+ * @brief Fixed-size pool of worker threads.
+ *
+ * A pool is the default executor for `ParallelFor`. Any type providing
+ * `Concurrency()` and `Run(task)` with the same semantics can be used instead.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief Construct a pool running tasks on `concurrency` threads.
+   *
+   * The calling thread of `Run()` counts as one of them, so
+   * `concurrency - 1` threads are started.
+   *
+   * @param concurrency Number of threads (default: hardware concurrency)
+   */
+  explicit ThreadPool(unsigned concurrency = DefaultConcurrency()) {
+    for (unsigned worker = 1; worker < std::max(concurrency, 1u); worker++) {
+      threads_.emplace_back([this, worker] { Work(worker); });
+    }
+  }
+
+  /// Stops and joins all worker threads
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    start_.notify_all();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool &other) = delete;
+  ThreadPool &operator=(const ThreadPool &other) = delete;
+
+  /// Number of threads taking part in `Run()`
+  unsigned Concurrency() const noexcept {
+    return static_cast<unsigned>(threads_.size()) + 1;
+  }
+
+  /**
+   * @brief Invoke `task(worker)` once per worker and wait for completion.
+   *
+   * `worker` ranges over `[0, Concurrency())`; the calling thread runs worker 0.
+   * When called from inside a task of the same pool, all workers run
+   * sequentially on the calling thread. The first exception thrown by a task
+   * is rethrown after all workers have finished.
+   *
+   * @param task Callable taking the worker index
+   */
+  template <typename F>
+  void Run(F &&task) {
+    if (Current() == this) {
+      for (unsigned worker = 0; worker < Concurrency(); worker++) {
+        task(worker);
+      }
+      return;
+    }
+    std::lock_guard<std::mutex> run(run_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task_ = [&task](unsigned worker) { task(worker); };
+      pending_ = static_cast<unsigned>(threads_.size());
+      generation_++;
+    }
+    start_.notify_all();
+    Invoke(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return pending_ == 0; });
+    task_ = nullptr;
+    if (error_) {
+      std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+  }
+
+  /// Hardware concurrency, or 1 if unknown
+  static unsigned DefaultConcurrency() noexcept {
+    return std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+ private:
+  std::vector<std::thread> threads_;      ///< Worker threads (excluding caller)
+  std::mutex run_;                        ///< Serializes concurrent `Run()` calls
+  std::mutex mutex_;                      ///< Guards the state below
+  std::condition_variable start_;         ///< Signals a new task or stop
+  std::condition_variable done_;          ///< Signals all workers finished
+  std::function<void(unsigned)> task_;    ///< Current task
+  std::exception_ptr error_;              ///< First exception of the current task
+  std::size_t generation_ = 0;            ///< Incremented per `Run()`
+  unsigned pending_ = 0;                  ///< Workers yet to finish
+  bool stop_ = false;                     ///< Set on destruction
+
+  // Pool whose task runs on the current thread
+  static const ThreadPool *&Current() noexcept {
+    static thread_local const ThreadPool *current = nullptr;
+    return current;
+  }
+
+  void Invoke(unsigned worker) noexcept {
+    auto previous = std::exchange(Current(), this);
+    try {
+      task_(worker);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+    Current() = previous;
+  }
+
+  void Work(unsigned worker) {
+    std::size_t seen = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        start_.wait(lock, [&] { return stop_ || generation_ != seen; });
+        if (stop_) {
+          return;
+        }
+        seen = generation_;
+      }
+      Invoke(worker);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--pending_ == 0) {
+          done_.notify_one();
+        }
+      }
+    }
+  }
+};
+
+/// Process-wide pool used when no executor is given
+inline ThreadPool &DefaultPool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+namespace Detail {
+
+// Grain giving each worker several ranges to balance uneven work
+inline std::ptrdiff_t DefaultGrain(std::ptrdiff_t length, unsigned concurrency) noexcept {
+  return std::max<std::ptrdiff_t>(length / (static_cast<std::ptrdiff_t>(concurrency) * 8), 1);
+}
+
+// Enabled for containers providing begin() and end() members
+template <typename C>
+using EnableIfContainer = std::void_t<decltype(std::declval<C &>().begin()), decltype(std::declval<C &>().end())>;
+
+// Minimum length worth sorting or reducing in parallel
+inline constexpr std::ptrdiff_t ParallelCutoff = 1 << 14;
+
+// Raw pointer for contiguous iterators (C++20), so kernels run on pointers
+template <typename I>
+auto Unwrap(I iterator) {
+#if ITERABLE_CPP_20
+  if constexpr (std::contiguous_iterator<I>) {
+    return std::to_address(iterator);
+  } else {
+    return iterator;
+  }
+#else
+  return iterator;
+#endif
+}
+
+// Start of worker's share of `length` elements split evenly over `count` workers
+inline std::ptrdiff_t Share(std::ptrdiff_t length, unsigned worker, unsigned count) noexcept {
+  return length / count * worker + std::min<std::ptrdiff_t>(worker, length % count);
+}
+
+// Number of elements taken from `a` among the first `k` outputs of merging
+// `[a, a + na)` and `[b, b + nb)`, with ties taken from `a` first
+template <typename I, typename C>
+std::ptrdiff_t MergeSplit(I a, std::ptrdiff_t na, I b, std::ptrdiff_t nb, std::ptrdiff_t k, C &comp) {
+  auto low = std::max<std::ptrdiff_t>(0, k - nb);
+  auto high = std::min(k, na);
+  while (low < high) {
+    auto middle = low + (high - low) / 2;
+    if (!comp(b[k - middle - 1], a[middle])) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+// Move-merge two sorted runs into `out`, each worker producing one slice
+// (all splits are found before any element is moved from)
+template <typename I, typename O, typename C, typename E>
+void ParallelMerge(I a, std::ptrdiff_t na, I b, std::ptrdiff_t nb, O out, C &comp, E &executor) {
+  unsigned count = executor.Concurrency();
+  std::vector<std::ptrdiff_t> splits(count + 1);
+  for (unsigned worker = 0; worker <= count; worker++) {
+    splits[worker] = MergeSplit(a, na, b, nb, Share(na + nb, worker, count), comp);
+  }
+  executor.Run([&](unsigned worker) {
+    auto first = Share(na + nb, worker, count);
+    auto last = Share(na + nb, worker + 1, count);
+    auto a_first = splits[worker];
+    auto a_last = splits[worker + 1];
+    std::merge(std::make_move_iterator(a + a_first), std::make_move_iterator(a + a_last),
+               std::make_move_iterator(b + (first - a_first)), std::make_move_iterator(b + (last - a_last)),
+               out + first, comp);
+  });
+}
+
+// Merge adjacent sorted runs of `source` pairwise into `target`
+template <typename I, typename O, typename C, typename E>
+void MergeRuns(I source, O target, std::vector<std::ptrdiff_t> &bounds, C &comp, E &executor) {
+  std::vector<std::ptrdiff_t> merged{0};
+  for (std::size_t run = 0; run + 1 < bounds.size(); run += 2) {
+    auto middle = bounds[run + 1];
+    auto last = run + 2 < bounds.size() ? bounds[run + 2] : middle;
+    ParallelMerge(source + bounds[run], middle - bounds[run], source + middle, last - middle,
+                  target + bounds[run], comp, executor);
+    merged.push_back(last);
+  }
+  bounds = std::move(merged);
+}
+
+} // namespace Detail
+
+/**
+ * @brief Apply `fn` to every element of `[first, last)` in parallel.
+ *
+ * The range is split into ranges of `grain` elements that workers claim
+ * dynamically, so faster workers take over more of the range.
+ *
+ * @param first Random access iterator to the first element
+ * @param last Iterator one past the last element
+ * @param fn Callable invoked with each element
+ * @param grain Elements per claimed range (0: chosen from length and concurrency)
+ * @param executor Executor providing `Concurrency()` and `Run(task)`
+ */
+template <typename I, typename F, typename E>
+void ParallelFor(I first, I last, F fn, std::ptrdiff_t grain, E &executor) {
+  static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+    typename std::iterator_traits<I>::iterator_category>,
+    "ParallelFor requires random access iterators");
+
+  std::ptrdiff_t length = last - first;
+  if (length <= 0) {
+    return;
+  }
+  if (grain <= 0) {
+    grain = Detail::DefaultGrain(length, executor.Concurrency());
+  }
+  if (grain >= length || executor.Concurrency() <= 1) {
+    std::for_each(first, last, fn);
+    return;
+  }
+  std::ptrdiff_t count = (length - 1) / grain + 1;
+  std::atomic<std::ptrdiff_t> next{0};
+
+  executor.Run([&](unsigned) {
+    for (auto index = next.fetch_add(1, std::memory_order_relaxed); index < count;
+              index = next.fetch_add(1, std::memory_order_relaxed)) {
+      auto offset = index * grain;
+      auto begin = first + offset;
+      std::for_each(begin, length - offset > grain ? begin + grain : last, fn);
+    }
+  });
+}
+
+/**
+ * @brief Apply `fn` to every element of `[first, last)` on the default pool.
+ */
+template <typename I, typename F>
+void ParallelFor(I first, I last, F fn, std::ptrdiff_t grain = 0) {
+  ParallelFor(first, last, std::move(fn), grain, DefaultPool());
+}
+
+/**
+ * @brief Sort `[first, last)` in parallel (not stable).
+ *
+ * Each worker sorts one block, then blocks are merged pairwise, every merge
+ * being split across all workers by merge path, through a buffer of
+ * `last - first` elements. The value type must be default constructible and
+ * move assignable. Contiguous iterators are sorted through raw pointers
+ * (C++20); short ranges are sorted with `std::sort`.
+ *
+ * @param first Random access iterator to the first element
+ * @param last Iterator one past the last element
+ * @param comp Strict weak ordering
+ * @param executor Executor providing `Concurrency()` and `Run(task)`
+ */
+template <typename I, typename C, typename E>
+void ParallelSort(I first, I last, C comp, E &executor) {
+  static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+    typename std::iterator_traits<I>::iterator_category>,
+    "ParallelSort requires random access iterators");
+
+  std::ptrdiff_t length = last - first;
+  unsigned count = executor.Concurrency();
+  if (length < Detail::ParallelCutoff || count <= 1) {
+    std::sort(first, last, comp);
+    return;
+  }
+  auto data = Detail::Unwrap(first);
+  std::vector<std::ptrdiff_t> bounds(count + 1);
+  for (unsigned block = 0; block <= count; block++) {
+    bounds[block] = Detail::Share(length, block, count);
+  }
+  executor.Run([&](unsigned worker) {
+    std::sort(data + bounds[worker], data + bounds[worker + 1], comp);
+  });
+
+  std::vector<typename std::iterator_traits<I>::value_type> buffer(static_cast<std::size_t>(length));
+  bool buffered = false;
+  while (bounds.size() > 2) {
+    if (buffered) {
+      Detail::MergeRuns(buffer.data(), data, bounds, comp, executor);
+    } else {
+      Detail::MergeRuns(data, buffer.data(), bounds, comp, executor);
+    }
+    buffered = !buffered;
+  }
+  if (buffered) {
+    // Merging with an empty run moves the buffer back in parallel
+    Detail::ParallelMerge(buffer.data(), length, buffer.data(), 0, data, comp, executor);
+  }
+}
+
+/**
+ * @brief Sort `[first, last)` in parallel on the default pool.
+ */
+template <typename I, typename C = std::less<>>
+void ParallelSort(I first, I last, C comp = {}) {
+  ParallelSort(first, last, std::move(comp), DefaultPool());
+}
+
+/**
+ * @brief Reduce `[first, last)` with `op` in parallel.
+ *
+ * Each worker folds one contiguous block from its first element and the
+ * partial results are folded into `init` in order, so `op` needs to be
+ * associative but not commutative, and the result does not depend on
+ * scheduling. Contiguous iterators are reduced through raw pointers (C++20).
+ *
+ * @param first Random access iterator to the first element
+ * @param last Iterator one past the last element
+ * @param init Initial value
+ * @param op Associative binary operation
+ * @param executor Executor providing `Concurrency()` and `Run(task)`
+ * @return `init` combined with all elements
+ */
+template <typename I, typename T, typename Op, typename E>
+T ParallelReduce(I first, I last, T init, Op op, E &executor) {
+  static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+    typename std::iterator_traits<I>::iterator_category>,
+    "ParallelReduce requires random access iterators");
+
+  std::ptrdiff_t length = last - first;
+  unsigned count = executor.Concurrency();
+  auto data = Detail::Unwrap(first);
+  if (length < Detail::ParallelCutoff || count <= 1) {
+    return std::accumulate(data, data + length, std::move(init), op);
+  }
+  std::vector<std::optional<T>> partials(count);
+  executor.Run([&](unsigned worker) {
+    auto begin = Detail::Share(length, worker, count);
+    auto end = Detail::Share(length, worker + 1, count);
+    if (begin != end) {
+      partials[worker].emplace(std::accumulate(data + begin + 1, data + end, T(data[begin]), op));
+    }
+  });
+  for (auto &partial : partials) {
+    if (partial) {
+      init = op(std::move(init), std::move(*partial));
+    }
+  }
+  return init;
+}
+
+/**
+ * @brief Reduce `[first, last)` with `op` in parallel on the default pool.
+ */
+template <typename I, typename T, typename Op = std::plus<>>
+T ParallelReduce(I first, I last, T init, Op op = {}) {
+  return ParallelReduce(first, last, std::move(init), std::move(op), DefaultPool());
+}
+
+/**
+ * @brief Apply `fn` to every element of `container` in parallel on `executor`.
+ *
+ * @param container Container with random access `begin()` and `end()`
+ * @param fn Callable invoked with each element
+ * @param grain Elements per claimed range (0: chosen automatically)
+ * @param executor Executor providing `Concurrency()` and `Run(task)`
+ */
+template <typename C, typename F, typename E, typename = Detail::EnableIfContainer<C>>
+void ParallelFor(C &container, F fn, std::ptrdiff_t grain, E &executor) {
+  ParallelFor(container.begin(), container.end(), std::move(fn), grain, executor);
+}
+
+/**
+ * @brief Apply `fn` to every element of `container` in parallel on the default pool.
+ */
+template <typename C, typename F, typename = Detail::EnableIfContainer<C>>
+void ParallelFor(C &container, F fn, std::ptrdiff_t grain = 0) {
+  ParallelFor(container.begin(), container.end(), std::move(fn), grain, DefaultPool());
+}
+
+/**
+ * @brief Sort the elements of `container` in parallel on `executor`.
+ *
+ * @param container Container with random access `begin()` and `end()`
+ * @param comp Strict weak ordering
+ * @param executor Executor providing `Concurrency()` and `Run(task)`
+ */
+template <typename C, typename Cmp, typename E, typename = Detail::EnableIfContainer<C>>
+void ParallelSort(C &container, Cmp comp, E &executor) {
+  ParallelSort(container.begin(), container.end(), std::move(comp), executor);
+}
+
+/**
+ * @brief Sort the elements of `container` in parallel on the default pool.
+ */
+template <typename C, typename Cmp = std::less<>, typename = Detail::EnableIfContainer<C>>
+void ParallelSort(C &container, Cmp comp = {}) {
+  ParallelSort(container.begin(), container.end(), std::move(comp), DefaultPool());
+}
+
+/**
+ * @brief Reduce the elements of `container` with `op` in parallel on `executor`.
+ *
+ * @param container Container with random access `begin()` and `end()`
+ * @param init Initial value
+ * @param op Associative binary operation
+ * @param executor Executor providing `Concurrency()` and `Run(task)`
+ * @return `init` combined with all elements
+ */
+template <typename C, typename T, typename Op, typename E, typename = Detail::EnableIfContainer<const C>>
+T ParallelReduce(const C &container, T init, Op op, E &executor) {
+  return ParallelReduce(container.begin(), container.end(), std::move(init), std::move(op), executor);
+}
+
+/**
+ * @brief Reduce the elements of `container` with `op` in parallel on the default pool.
+ */
+template <typename C, typename T, typename Op = std::plus<>, typename = Detail::EnableIfContainer<const C>>
+T ParallelReduce(const C &container, T init, Op op = {}) {
+  return ParallelReduce(container.begin(), container.end(), std::move(init), std::move(op), DefaultPool());
+}
+} // namespace Iterable
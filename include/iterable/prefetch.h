@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @brief Provides an iterator adapter that prefetches elements ahead of the scan.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <iterable/define.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace Iterable {
+namespace Detail {
+
+// Hint the cache to load the line holding `address` for reading
+inline void Prefetch(const void *address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_prefetch(static_cast<const char *>(address), _MM_HINT_T0);
+#else
+  static_cast<void>(address);
+#endif
+}
+
+} // namespace Detail
+
+/**
+ * @brief Forward iterator prefetching the element `Distance` positions ahead.
+ *
+ * Each increment issues a prefetch for the address of the element `Distance`
+ * steps past the current one, as long as it lies before the end of the range.
+ * Intended for linear scans over memory-bound or indirect `operator[]`
+ * implementations.
+ *
+ * @tparam I Underlying random access iterator with lvalue references
+ * @tparam Distance Prefetch distance in elements
+ */
+template <typename I, std::size_t Distance>
+class PrefetchIterator {
+  static_assert(Distance > 0, "Prefetch distance must be positive");
+
+ public:
+  using iterator_category = std::forward_iterator_tag;                       ///< Iterator category tag
+  using difference_type   = typename std::iterator_traits<I>::difference_type; ///< Difference type
+  using value_type        = typename std::iterator_traits<I>::value_type;    ///< Value type
+  using pointer           = typename std::iterator_traits<I>::pointer;       ///< Pointer type
+  using reference         = typename std::iterator_traits<I>::reference;     ///< Reference type
+
+  /// Default constructor
+  PrefetchIterator() = default;
+
+  /**
+   * @brief Construct over `[current, last)`.
+   *
+   * @param current Iterator to the current element
+   * @param last Iterator one past the last element
+   */
+  PrefetchIterator(I current, I last)
+    : current_(current),
+      ahead_(last - current > Ahead ? current + Ahead : last),
+      last_(last) {}
+
+  /// Dereference operator
+  reference operator*() const {
+    return *current_;
+  }
+
+  /// Member access operator
+  pointer operator->() const {
+    return std::addressof(*current_);
+  }
+
+  /// Prefix increment
+  PrefetchIterator &operator++() {
+    ++current_;
+    if (ahead_ != last_) {
+      Detail::Prefetch(std::addressof(*ahead_));
+      ++ahead_;
+    }
+    return *this;
+  }
+
+  /// Postfix increment
+  PrefetchIterator operator++(int) {
+    auto temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  /// Difference between iterators
+  difference_type operator-(const PrefetchIterator &other) const {
+    return current_ - other.current_;
+  }
+
+  // Comparison operators
+  bool operator==(const PrefetchIterator &other) const {
+    return current_ == other.current_;
+  }
+  bool operator!=(const PrefetchIterator &other) const {
+    return current_ != other.current_;
+  }
+
+ private:
+  static constexpr difference_type Ahead = static_cast<difference_type>(Distance);
+
+  I current_{}; ///< Iterator to the current element
+  I ahead_{};   ///< Next element to prefetch
+  I last_{};    ///< Iterator one past the last element
+};
+} // namespace Iterable
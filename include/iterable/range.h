@@ -0,0 +1,84 @@
+/**
+ * @file
+ * @brief Provides a non-owning range over an iterator/sentinel pair.
+ */
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include <iterable/define.h>
+
+#if ITERABLE_CPP_20
+#include <ranges>
+#endif
+
+namespace Iterable {
+/**
+ * @brief Non-owning view over `[first, last)`.
+ *
+ * Used as the return type of `For` views. `last` may be a `Sentinel`, in
+ * which case the length is fixed when the range is created.
+ *
+ * @tparam I Iterator type
+ * @tparam S Sentinel type (default: same as iterator)
+ */
+template <typename I, typename S = I>
+class Range {
+ public:
+  using difference_type = typename std::iterator_traits<I>::difference_type; ///< Difference type
+
+  /// Default constructor
+  Range() = default;
+
+  /**
+   * @brief Construct from an iterator and a sentinel.
+   *
+   * @param first Iterator to the first element
+   * @param last Sentinel one past the last element
+   */
+  constexpr Range(I first, S last)
+    : first_(first), last_(last) {}
+
+  /// Iterator to the first element
+  constexpr I begin() const {
+    return first_;
+  }
+
+  /// Sentinel one past the last element
+  constexpr S end() const {
+    return last_;
+  }
+
+  /// Number of elements
+  constexpr difference_type size() const {
+    return last_ - first_;
+  }
+
+  /// Number of elements (the `For` container contract)
+  constexpr difference_type Length() const {
+    return size();
+  }
+
+  /// Checks whether the range is empty
+  constexpr bool empty() const {
+    return first_ == last_;
+  }
+
+  /// Element access relative to the first element
+  constexpr decltype(auto) operator[](difference_type n) const {
+    return first_[n];
+  }
+
+ private:
+  I first_{}; ///< Iterator to the first element
+  S last_{};  ///< Sentinel one past the last element
+};
+} // namespace Iterable
+
+#if ITERABLE_CPP_20
+template <typename I, typename S>
+inline constexpr bool std::ranges::enable_borrowed_range<Iterable::Range<I, S>> = true;
+
+template <typename I, typename S>
+inline constexpr bool std::ranges::enable_view<Iterable::Range<I, S>> = true;
+#endif
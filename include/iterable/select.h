@@ -0,0 +1,305 @@
+/**
+ * @file
+ * @brief Provides selection-vector views over the elements chosen by a bitmask or an index list.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <iterable/define.h>
+#include <iterable/view.h>
+
+#if ITERABLE_CPP_20
+#include <bit>
+#endif
+
+namespace Iterable {
+namespace Detail {
+
+// Index of the lowest set bit of a non-zero word
+template <typename W>
+inline int CountrZero(W word) noexcept {
+#if ITERABLE_CPP_20
+  return std::countr_zero(word);
+#elif defined(__GNUC__) || defined(__clang__)
+  if constexpr (sizeof(W) <= sizeof(unsigned)) {
+    return __builtin_ctz(word);
+  } else {
+    return __builtin_ctzll(word);
+  }
+#else
+  int index = 0;
+  for (; (word & 1) == 0; word >>= 1) {
+    index++;
+  }
+  return index;
+#endif
+}
+
+// Enabled for ranges of integral indices
+template <typename R>
+using EnableIfIndices = std::enable_if_t<std::is_integral_v<std::decay_t<decltype(*std::begin(std::declval<const R &>()))>>>;
+
+// Checks whether every index in `indices` lies in `[0, length)`
+template <typename R>
+bool IndicesWithin(const R &indices, std::ptrdiff_t length) {
+  for (auto index : indices) {
+    auto position = static_cast<std::ptrdiff_t>(index);
+    if (position < 0 || position >= length) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace Detail
+
+/**
+ * @brief Non-owning bitmask of `Length()` bits packed into words.
+ *
+ * Bit `i` of the mask is bit `i % Bits` of word `i / Bits`. Bits past
+ * `Length()` in the last word are ignored.
+ *
+ * @tparam W Unsigned word type
+ */
+template <typename W = std::uint64_t>
+class Bitmask {
+  static_assert(std::is_unsigned_v<W>, "Bitmask words must be unsigned");
+
+ public:
+  static constexpr std::size_t Bits = sizeof(W) * 8; ///< Bits per word
+
+  /// Default constructor (empty mask)
+  Bitmask() = default;
+
+  /**
+   * @brief Construct over `(length + Bits - 1) / Bits` words.
+   *
+   * @param words First word of the mask
+   * @param length Number of bits
+   */
+  Bitmask(const W *words, std::size_t length) noexcept
+    : words_(words), length_(length) {}
+
+  /// Word `index`, with the bits past `Length()` cleared
+  W Word(std::size_t index) const noexcept {
+    auto word = words_[index];
+    if (index + 1 == WordCount() && length_ % Bits != 0) {
+      word &= static_cast<W>((W(1) << (length_ % Bits)) - 1);
+    }
+    return word;
+  }
+
+  /// Number of words
+  std::size_t WordCount() const noexcept {
+    return (length_ + Bits - 1) / Bits;
+  }
+
+  /// Number of bits
+  std::size_t Length() const noexcept {
+    return length_;
+  }
+
+ private:
+  const W *words_ = nullptr; ///< First word
+  std::size_t length_ = 0;   ///< Number of bits
+};
+
+/**
+ * @brief Iterator over the elements whose bit is set in a `Bitmask`.
+ *
+ * Words are scanned with `countr_zero`, each step clearing the lowest set
+ * bit, so the cost is proportional to the number of words plus the number of
+ * selected elements rather than to the number of elements.
+ *
+ * @tparam I Random access iterator to the first element
+ * @tparam W Mask word type
+ */
+template <typename I, typename W>
+class MaskIterator : public Detail::ViewIteratorBase<MaskIterator<I, W>> {
+ public:
+  using value_type = typename std::iterator_traits<I>::value_type; ///< Value type
+  using reference  = typename std::iterator_traits<I>::reference;  ///< Reference type
+
+  /// Default constructor
+  MaskIterator() = default;
+
+  /**
+   * @brief Construct at the first selected element.
+   *
+   * @param first Iterator to the element of bit zero
+   * @param mask Selected elements
+   */
+  MaskIterator(I first, Bitmask<W> mask)
+    : first_(first), mask_(mask), word_count_(mask.WordCount()) {
+    if (word_count_ != 0) {
+      bits_ = mask_.Word(0);
+      Skip();
+    }
+  }
+
+  /// Dereference operator
+  reference operator*() const {
+    return first_[static_cast<typename std::iterator_traits<I>::difference_type>(Index())];
+  }
+
+  /// Prefix increment
+  MaskIterator &operator++() {
+    bits_ &= bits_ - 1;
+    Skip();
+    return *this;
+  }
+
+  /// Postfix increment
+  MaskIterator operator++(int) {
+    auto temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  /// Index of the current element
+  std::size_t Index() const noexcept {
+    return word_ * Bitmask<W>::Bits + static_cast<std::size_t>(Detail::CountrZero(bits_));
+  }
+
+  /// Checks whether every selected element has been visited
+  bool Done() const noexcept {
+    return bits_ == 0;
+  }
+
+ private:
+  I first_{};                  ///< Iterator to the element of bit zero
+  Bitmask<W> mask_;            ///< Selected elements
+  std::size_t word_count_ = 0; ///< Number of words of the mask
+  std::size_t word_ = 0;       ///< Current word
+  W bits_ = 0;                 ///< Unvisited set bits of the current word
+
+  // Advance to the next word with a set bit
+  void Skip() noexcept {
+    while (bits_ == 0 && ++word_ < word_count_) {
+      bits_ = mask_.Word(word_);
+    }
+  }
+};
+
+/**
+ * @brief Lazy view over the elements whose bit is set in a `Bitmask`.
+ *
+ * @tparam I Random access iterator to the first element
+ * @tparam W Mask word type
+ */
+template <typename I, typename W>
+class MaskView : public Detail::Pipeline<MaskView<I, W>> {
+ public:
+  /**
+   * @brief Construct over the selected elements of `[first, first + mask.Length())`.
+   *
+   * @param first Iterator to the element of bit zero
+   * @param mask Selected elements
+   */
+  MaskView(I first, Bitmask<W> mask)
+    : first_(first), mask_(mask) {}
+
+  /// Iterator to the first selected element
+  MaskIterator<I, W> begin() const {
+    return MaskIterator<I, W>(first_, mask_);
+  }
+
+ private:
+  I first_;         ///< Iterator to the element of bit zero
+  Bitmask<W> mask_; ///< Selected elements
+};
+
+/**
+ * @brief Iterator over the elements at the positions of an index list.
+ *
+ * @tparam I Random access iterator to the first element
+ * @tparam J Iterator over the indices
+ */
+template <typename I, typename J>
+class IndexIterator : public Detail::ViewIteratorBase<IndexIterator<I, J>> {
+ public:
+  using value_type = typename std::iterator_traits<I>::value_type; ///< Value type
+  using reference  = typename std::iterator_traits<I>::reference;  ///< Reference type
+
+  /// Default constructor
+  IndexIterator() = default;
+
+  /**
+   * @brief Construct over the indices `[current, last)`.
+   *
+   * @param first Iterator to the element of index zero
+   * @param current Iterator to the current index
+   * @param last Iterator one past the last index
+   */
+  IndexIterator(I first, J current, J last)
+    : first_(first), current_(current), last_(last) {}
+
+  /// Dereference operator
+  reference operator*() const {
+    return first_[static_cast<typename std::iterator_traits<I>::difference_type>(*current_)];
+  }
+
+  /// Prefix increment
+  IndexIterator &operator++() {
+    ++current_;
+    return *this;
+  }
+
+  /// Postfix increment
+  IndexIterator operator++(int) {
+    auto temp = *this;
+    ++current_;
+    return temp;
+  }
+
+  /// Index of the current element
+  std::size_t Index() const {
+    return static_cast<std::size_t>(*current_);
+  }
+
+  /// Checks whether every index has been visited
+  bool Done() const {
+    return current_ == last_;
+  }
+
+ private:
+  I first_{};   ///< Iterator to the element of index zero
+  J current_{}; ///< Current index
+  J last_{};    ///< One past the last index
+};
+
+/**
+ * @brief Lazy view over the elements at the positions of an index list.
+ *
+ * Indices are visited in list order; they need not be sorted or unique.
+ *
+ * @tparam I Random access iterator to the first element
+ * @tparam J Iterator over the indices
+ */
+template <typename I, typename J>
+class IndexView : public Detail::Pipeline<IndexView<I, J>> {
+ public:
+  /**
+   * @brief Construct over the indices `[current, last)`.
+   *
+   * @param first Iterator to the element of index zero
+   * @param current Iterator to the first index
+   * @param last Iterator one past the last index
+   */
+  IndexView(I first, J current, J last)
+    : first_(first), current_(current), last_(last) {}
+
+  /// Iterator to the element of the first index
+  IndexIterator<I, J> begin() const {
+    return IndexIterator<I, J>(first_, current_, last_);
+  }
+
+ private:
+  I first_;   ///< Iterator to the element of index zero
+  J current_; ///< First index
+  J last_;    ///< One past the last index
+};
+} // namespace Iterable
@@ -0,0 +1,101 @@
+/**
+ * @file
+ * @brief Provides an append-only log iterable while a writer appends to it.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <iterable/iterable.h>
+
+namespace Iterable {
+/**
+ * @brief Append-only sequence with one writer and any number of lock-free readers.
+ *
+ * Elements live in fixed blocks of `B` elements that never move, so appending
+ * does not invalidate iterators. `Append()` constructs the element and then
+ * publishes the new length with a release store; `Length()` reads it with an
+ * acquire load. Iterating a `Snapshot()` (or any range whose end was taken
+ * from `Length()`) therefore only touches fully constructed elements, while
+ * the writer never waits for readers. Elements are read-only once appended.
+ *
+ * @tparam T Element type
+ * @tparam B Elements per block (a power of two)
+ */
+template <typename T, std::size_t B = 1024>
+class AppendLog : public For<AppendLog<T, B>> {
+  static_assert(B > 0 && (B & (B - 1)) == 0, "Block size must be a power of two");
+
+ public:
+  /**
+   * @brief Construct an empty log.
+   *
+   * @param capacity Maximum number of elements (rounded up to whole blocks)
+   */
+  explicit AppendLog(std::size_t capacity)
+    : blocks_((capacity + B - 1) / B), directory_(std::make_unique<T *[]>(blocks_)) {}
+
+  /// Destroys all elements
+  ~AppendLog() {
+    auto length = length_.load(std::memory_order_relaxed);
+    for (std::size_t index = 0; index < length; index++) {
+      Slot(index)->~T();
+    }
+    for (std::size_t block = 0; block < blocks_ && directory_[block] != nullptr; block++) {
+      std::allocator<T>().deallocate(directory_[block], B);
+    }
+  }
+
+  AppendLog(const AppendLog &other) = delete;
+  AppendLog &operator=(const AppendLog &other) = delete;
+
+  /**
+   * @brief Append an element (writer thread only).
+   *
+   * @param args Constructor arguments of the element
+   * @return The appended element
+   * @throws std::length_error If the capacity is exhausted
+   */
+  template <typename... Args>
+  const T &Append(Args &&...args) {
+    auto length = length_.load(std::memory_order_relaxed);
+    if (length == blocks_ * B) {
+      throw std::length_error("AppendLog capacity exhausted");
+    }
+    if (length % B == 0 && directory_[length / B] == nullptr) {
+      directory_[length / B] = std::allocator<T>().allocate(B);
+    }
+    auto *element = ::new (static_cast<void *>(Slot(length))) T(std::forward<Args>(args)...);
+    length_.store(length + 1, std::memory_order_release);
+    return *element;
+  }
+
+  /// Element access (index below a previously read `Length()`)
+  const T &operator[](std::size_t index) const noexcept {
+    return *Slot(index);
+  }
+
+  /// Number of published elements (acquire load)
+  std::size_t Length() const noexcept {
+    return length_.load(std::memory_order_acquire);
+  }
+
+  /// Maximum number of elements
+  std::size_t Capacity() const noexcept {
+    return blocks_ * B;
+  }
+
+ private:
+  std::size_t blocks_;                 ///< Number of directory entries
+  std::unique_ptr<T *[]> directory_;   ///< Blocks, allocated by the writer on demand
+  std::atomic<std::size_t> length_{0}; ///< Published length
+
+  T *Slot(std::size_t index) const noexcept {
+    return directory_[index / B] + index % B;
+  }
+};
+} // namespace Iterable
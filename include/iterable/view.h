@@ -0,0 +1,443 @@
+/**
+ * @file
+ * @brief Provides lazy map/filter/take views that fuse into a single pass.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <iterable/define.h>
+
+namespace Iterable {
+/**
+ * @brief End marker shared by all lazy views and `Tag::Input` iterators.
+ *
+ * These iterators know when they are exhausted, so the end of every such
+ * range is the same empty type and comparing against it checks `Done()`.
+ */
+struct ViewEnd {};
+
+template <typename V, typename F>
+class MapView;
+template <typename V, typename P>
+class FilterView;
+template <typename V>
+class TakeView;
+
+namespace Detail {
+
+// Function object returning its argument as an rvalue reference
+struct MoveOut {
+  template <typename U>
+  constexpr std::remove_reference_t<U> &&operator()(U &&value) const noexcept {
+    return std::move(value);
+  }
+};
+
+/**
+ * @brief Comparison with `ViewEnd` and shared aliases for view iterators.
+ *
+ * @tparam I Concrete view iterator type (CRTP), providing `Done()`
+ */
+template <typename I>
+struct ViewIteratorBase {
+  using iterator_category = std::input_iterator_tag; ///< Iterator category tag
+  using difference_type   = std::ptrdiff_t;          ///< Difference type
+
+  // Comparison operators
+  friend bool operator==(const I &lhs, ViewEnd) {
+    return lhs.Done();
+  }
+  friend bool operator!=(const I &lhs, ViewEnd) {
+    return !lhs.Done();
+  }
+  friend bool operator==(ViewEnd, const I &rhs) {
+    return rhs.Done();
+  }
+  friend bool operator!=(ViewEnd, const I &rhs) {
+    return !rhs.Done();
+  }
+};
+
+/**
+ * @brief Adaptor members shared by all lazy views.
+ *
+ * @tparam V Concrete view type (CRTP)
+ */
+template <typename V>
+class Pipeline {
+ public:
+  /**
+   * @brief Returns a view applying `fn` to each element.
+   *
+   * @param fn Callable invoked with each element on dereference
+   */
+  template <typename F>
+  MapView<V, F> Map(F fn) const {
+    return MapView<V, F>(Self(), std::move(fn));
+  }
+
+  /**
+   * @brief Returns a view skipping elements not satisfying `pred`.
+   *
+   * @param pred Predicate invoked with each element
+   */
+  template <typename P>
+  FilterView<V, P> Filter(P pred) const {
+    return FilterView<V, P>(Self(), std::move(pred));
+  }
+
+  /**
+   * @brief Returns a view of at most the first `count` elements.
+   *
+   * @param count Maximum number of elements
+   */
+  TakeView<V> Take(std::size_t count) const {
+    return TakeView<V>(Self(), count);
+  }
+
+  /// Sentinel one past the last element
+  ViewEnd end() const noexcept {
+    return {};
+  }
+
+ private:
+  const V &Self() const noexcept {
+    return static_cast<const V &>(*this);
+  }
+};
+
+} // namespace Detail
+
+/**
+ * @brief Iterator over `[first, last)` that knows its own end.
+ *
+ * @tparam I Underlying iterator type
+ * @tparam S Underlying sentinel type
+ */
+template <typename I, typename S>
+class SourceIterator : public Detail::ViewIteratorBase<SourceIterator<I, S>> {
+ public:
+  using value_type = typename std::iterator_traits<I>::value_type; ///< Value type
+  using reference  = typename std::iterator_traits<I>::reference;  ///< Reference type
+
+  /// Default constructor
+  SourceIterator() = default;
+
+  /**
+   * @brief Construct over `[current, last)`.
+   *
+   * @param current Iterator to the current element
+   * @param last Sentinel one past the last element
+   */
+  SourceIterator(I current, S last)
+    : current_(current), last_(last) {}
+
+  /// Dereference operator
+  reference operator*() const {
+    return *current_;
+  }
+
+  /// Prefix increment
+  SourceIterator &operator++() {
+    ++current_;
+    return *this;
+  }
+
+  /// Postfix increment
+  SourceIterator operator++(int) {
+    auto temp = *this;
+    ++current_;
+    return temp;
+  }
+
+  /// Checks whether the underlying range is exhausted
+  bool Done() const {
+    return current_ == last_;
+  }
+
+ private:
+  I current_{}; ///< Iterator to the current element
+  S last_{};    ///< Sentinel one past the last element
+};
+
+/**
+ * @brief Lazy view over `[first, last)`, the start of every pipeline.
+ *
+ * @tparam I Iterator type
+ * @tparam S Sentinel type
+ */
+template <typename I, typename S = I>
+class SourceView : public Detail::Pipeline<SourceView<I, S>> {
+ public:
+  /**
+   * @brief Construct over `[first, last)`.
+   *
+   * @param first Iterator to the first element
+   * @param last Sentinel one past the last element
+   */
+  SourceView(I first, S last)
+    : first_(first), last_(last) {}
+
+  /// Iterator to the first element
+  SourceIterator<I, S> begin() const {
+    return SourceIterator<I, S>(first_, last_);
+  }
+
+ private:
+  I first_; ///< Iterator to the first element
+  S last_;  ///< Sentinel one past the last element
+};
+
+/**
+ * @brief Iterator applying a function on dereference.
+ *
+ * @tparam I Underlying view iterator type
+ * @tparam F Function type
+ */
+template <typename I, typename F>
+class MapIterator : public Detail::ViewIteratorBase<MapIterator<I, F>> {
+ public:
+  using reference  = std::invoke_result_t<const F &, typename I::reference>; ///< Reference type
+  using value_type = std::decay_t<reference>;                                ///< Value type
+
+  /// Default constructor
+  MapIterator() = default;
+
+  /**
+   * @brief Construct from an underlying iterator and the view's function.
+   *
+   * @param current Underlying iterator
+   * @param fn Function owned by the view
+   */
+  MapIterator(I current, const F *fn)
+    : current_(current), fn_(fn) {}
+
+  /// Dereference operator
+  reference operator*() const {
+    return std::invoke(*fn_, *current_);
+  }
+
+  /// Prefix increment
+  MapIterator &operator++() {
+    ++current_;
+    return *this;
+  }
+
+  /// Postfix increment
+  MapIterator operator++(int) {
+    auto temp = *this;
+    ++current_;
+    return temp;
+  }
+
+  /// Checks whether the underlying view is exhausted
+  bool Done() const {
+    return current_.Done();
+  }
+
+ private:
+  I current_{};           ///< Underlying iterator
+  const F *fn_ = nullptr; ///< Function owned by the view
+};
+
+/**
+ * @brief Lazy view applying `fn` to each element of `V`.
+ *
+ * @tparam V Underlying view type
+ * @tparam F Function type
+ */
+template <typename V, typename F>
+class MapView : public Detail::Pipeline<MapView<V, F>> {
+ public:
+  /**
+   * @brief Construct from an underlying view and a function.
+   *
+   * @param base Underlying view
+   * @param fn Function applied to each element
+   */
+  MapView(V base, F fn)
+    : base_(std::move(base)), fn_(std::move(fn)) {}
+
+  /// Iterator to the first element
+  auto begin() const {
+    return MapIterator<decltype(base_.begin()), F>(base_.begin(), &fn_);
+  }
+
+ private:
+  V base_; ///< Underlying view
+  F fn_;   ///< Function applied to each element
+};
+
+/**
+ * @brief Iterator skipping elements not satisfying a predicate.
+ *
+ * @tparam I Underlying view iterator type
+ * @tparam P Predicate type
+ */
+template <typename I, typename P>
+class FilterIterator : public Detail::ViewIteratorBase<FilterIterator<I, P>> {
+ public:
+  using value_type = typename I::value_type; ///< Value type
+  using reference  = typename I::reference;  ///< Reference type
+
+  /// Default constructor
+  FilterIterator() = default;
+
+  /**
+   * @brief Construct at the first satisfying element from `current`.
+   *
+   * @param current Underlying iterator
+   * @param pred Predicate owned by the view
+   */
+  FilterIterator(I current, const P *pred)
+    : current_(current), pred_(pred) {
+    Skip();
+  }
+
+  /// Dereference operator
+  reference operator*() const {
+    return *current_;
+  }
+
+  /// Prefix increment
+  FilterIterator &operator++() {
+    ++current_;
+    Skip();
+    return *this;
+  }
+
+  /// Postfix increment
+  FilterIterator operator++(int) {
+    auto temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  /// Checks whether the underlying view is exhausted
+  bool Done() const {
+    return current_.Done();
+  }
+
+ private:
+  I current_{};             ///< Underlying iterator
+  const P *pred_ = nullptr; ///< Predicate owned by the view
+
+  // Advance to the next element satisfying the predicate
+  void Skip() {
+    while (!current_.Done() && !std::invoke(*pred_, *current_)) {
+      ++current_;
+    }
+  }
+};
+
+/**
+ * @brief Lazy view over the elements of `V` satisfying `pred`.
+ *
+ * @tparam V Underlying view type
+ * @tparam P Predicate type
+ */
+template <typename V, typename P>
+class FilterView : public Detail::Pipeline<FilterView<V, P>> {
+ public:
+  /**
+   * @brief Construct from an underlying view and a predicate.
+   *
+   * @param base Underlying view
+   * @param pred Predicate selecting elements
+   */
+  FilterView(V base, P pred)
+    : base_(std::move(base)), pred_(std::move(pred)) {}
+
+  /// Iterator to the first satisfying element
+  auto begin() const {
+    return FilterIterator<decltype(base_.begin()), P>(base_.begin(), &pred_);
+  }
+
+ private:
+  V base_; ///< Underlying view
+  P pred_; ///< Predicate selecting elements
+};
+
+/**
+ * @brief Iterator stopping after a fixed number of elements.
+ *
+ * @tparam I Underlying view iterator type
+ */
+template <typename I>
+class TakeIterator : public Detail::ViewIteratorBase<TakeIterator<I>> {
+ public:
+  using value_type = typename I::value_type; ///< Value type
+  using reference  = typename I::reference;  ///< Reference type
+
+  /// Default constructor
+  TakeIterator() = default;
+
+  /**
+   * @brief Construct from an underlying iterator and a remaining count.
+   *
+   * @param current Underlying iterator
+   * @param remaining Number of elements left to yield
+   */
+  TakeIterator(I current, std::size_t remaining)
+    : current_(current), remaining_(remaining) {}
+
+  /// Dereference operator
+  reference operator*() const {
+    return *current_;
+  }
+
+  /// Prefix increment
+  TakeIterator &operator++() {
+    ++current_;
+    --remaining_;
+    return *this;
+  }
+
+  /// Postfix increment
+  TakeIterator operator++(int) {
+    auto temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  /// Checks whether the count is reached or the underlying view is exhausted
+  bool Done() const {
+    return remaining_ == 0 || current_.Done();
+  }
+
+ private:
+  I current_{};               ///< Underlying iterator
+  std::size_t remaining_ = 0; ///< Number of elements left to yield
+};
+
+/**
+ * @brief Lazy view over at most the first `count` elements of `V`.
+ *
+ * @tparam V Underlying view type
+ */
+template <typename V>
+class TakeView : public Detail::Pipeline<TakeView<V>> {
+ public:
+  /**
+   * @brief Construct from an underlying view and a count.
+   *
+   * @param base Underlying view
+   * @param count Maximum number of elements
+   */
+  TakeView(V base, std::size_t count)
+    : base_(std::move(base)), count_(count) {}
+
+  /// Iterator to the first element
+  auto begin() const {
+    return TakeIterator<decltype(base_.begin())>(base_.begin(), count_);
+  }
+
+ private:
+  V base_;            ///< Underlying view
+  std::size_t count_; ///< Maximum number of elements
+};
+} // namespace Iterable
@@ -0,0 +1,69 @@
+/**
+ * @file
+ * @brief Provides joint iteration over several containers sharing one index.
+ */
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <iterable/iterable.h>
+
+namespace Iterable {
+/**
+ * @brief Non-owning view over several containers advanced by one index.
+ *
+ * Element `i` is a tuple of the containers' `operator[](i)` results, and the
+ * length is the shortest container's `Length()`, read once at construction.
+ * Iteration uses `Tag::Proxy`, so structured bindings refer directly to the
+ * underlying elements.
+ *
+ * @tparam Ds Container types (may be const-qualified)
+ */
+template <typename... Ds>
+class Zipped : public For<Zipped<Ds...>, Tag::Proxy> {
+  static_assert(sizeof...(Ds) > 0, "Zip requires at least one container");
+
+ public:
+  static constexpr bool Borrowed = true; ///< Elements belong to the zipped containers
+  using IndexType = std::common_type_t<Detail::Index<Ds>...>; ///< Shared index type
+
+  /**
+   * @brief Construct over the given containers.
+   *
+   * @param containers Containers to iterate jointly
+   */
+  explicit Zipped(Ds &...containers)
+    : containers_(std::addressof(containers)...),
+      length_(std::min({static_cast<IndexType>(containers.Length())...})) {}
+
+  /// Tuple of element references at `index`
+  std::tuple<decltype(std::declval<Ds &>()[std::declval<IndexType>()])...>
+  operator[](IndexType index) const {
+    return std::apply([index](Ds *...data) {
+      return std::tuple<decltype(std::declval<Ds &>()[index])...>((*data)[index]...);
+    }, containers_);
+  }
+
+  /// Length of the shortest container
+  IndexType Length() const noexcept {
+    return length_;
+  }
+
+ private:
+  std::tuple<Ds *...> containers_; ///< Zipped containers
+  IndexType length_;               ///< Length of the shortest container
+};
+
+/**
+ * @brief Returns a view iterating `containers` jointly by one index.
+ *
+ * @param containers Containers providing `operator[]` and `Length()`
+ */
+template <typename... Ds>
+Zipped<Ds...> Zip(Ds &...containers) {
+  return Zipped<Ds...>(containers...);
+}
+} // namespace Iterable
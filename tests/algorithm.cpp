@@ -0,0 +1,115 @@
+// Bulk copy, fill and find dispatch through ADL on For iterators
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Bulk : Iterable::For<Bulk> {
+  std::vector<int> values;
+  mutable int copies = 0;
+  int fills = 0;
+  mutable int finds = 0;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+  int *BulkCopy(std::size_t first, std::size_t last, int *out) const {
+    ++copies;
+    std::memcpy(out, values.data() + first, (last - first) * sizeof(int));
+    return out + (last - first);
+  }
+  void BulkFill(std::size_t first, std::size_t last, int value) {
+    ++fills;
+    std::fill(values.data() + first, values.data() + last, value);
+  }
+  std::size_t Find(std::size_t first, std::size_t last, int value) const {
+    ++finds;
+    for (; first != last && values[first] != value; ++first) {
+    }
+    return first;
+  }
+};
+
+struct Plain : Iterable::For<Plain> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+// Bulk hooks take storage indices, which strided iterators do not visit one to one
+struct Column : Iterable::For<Column, Iterable::Strided> {
+  std::vector<int> values{0, 1, 2, 3, 4, 5, 6, 7};
+
+  int &operator[](std::size_t index) { return values[index]; }
+  std::size_t Length() const { return 4; }
+  std::size_t Stride() const { return 2; }
+  template <typename O>
+  O BulkCopy(std::size_t first, std::size_t last, O out) {
+    return std::copy(values.begin() + first, values.begin() + last, out);
+  }
+  void BulkFill(std::size_t first, std::size_t last, int value) {
+    std::fill(values.begin() + first, values.begin() + last, value);
+  }
+  std::size_t Find(std::size_t, std::size_t last, int) { return last; }
+};
+
+void DispatchesToHooks() {
+  using std::copy;
+  using std::fill;
+  using std::find;
+  Bulk bulk;
+  bulk.values.resize(10);
+  std::iota(bulk.values.begin(), bulk.values.end(), 0);
+  std::vector<int> out(10);
+  CHECK(copy(bulk.begin() + 2, bulk.end(), out.data()) == out.data() + 8);
+  CHECK(out[0] == 2);
+  CHECK(bulk.copies == 1);
+  const Bulk &constant = bulk;
+  CHECK(copy(constant.begin(), constant.end(), out.data()) == out.data() + 10);
+  CHECK(bulk.copies == 2);
+  // Output iterators the hook does not accept use the element loop
+  std::vector<int> inserted;
+  copy(bulk.begin(), bulk.end(), std::back_inserter(inserted));
+  CHECK(inserted.size() == 10);
+  CHECK(bulk.copies == 2);
+
+  fill(bulk.begin(), bulk.begin() + 3, 7);
+  CHECK(bulk.values[2] == 7 && bulk.values[3] == 3);
+  CHECK(bulk.fills == 1);
+  CHECK(find(bulk.begin(), bulk.end(), 5) - bulk.begin() == 5);
+  CHECK(find(bulk.begin(), bulk.end(), 42) == bulk.end());
+  CHECK(bulk.finds == 2);
+}
+
+void FallsBack() {
+  using std::copy;
+  using std::fill;
+  using std::find;
+  Plain plain;
+  plain.values.resize(4);
+  std::vector<int> out(4);
+  fill(plain.begin(), plain.end(), 3);
+  CHECK(find(plain.begin(), plain.end(), 3) == plain.begin());
+  CHECK(copy(plain.begin(), plain.end(), out.begin()) == out.end());
+  CHECK((out == std::vector<int>{3, 3, 3, 3}));
+
+  Column column;
+  copy(column.begin(), column.end(), out.begin());
+  CHECK((out == std::vector<int>{0, 2, 4, 6}));
+  CHECK(find(column.begin(), column.end(), 4) - column.begin() == 2);
+  fill(column.begin(), column.end(), 9);
+  CHECK((column.values == std::vector<int>{9, 1, 9, 3, 9, 5, 9, 7}));
+}
+} // namespace
+
+int main() {
+  DispatchesToHooks();
+  FallsBack();
+  return Test::Result();
+}
@@ -0,0 +1,109 @@
+// Type-erased AnyRange over containers, inline and heap storage
+#include <cstddef>
+#include <list>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <iterable/any.h>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+// Larger than any inline buffer, so AnyRange allocates it
+struct Huge {
+  std::vector<int> *values;
+  char padding[200];
+
+  auto begin() const { return values->begin(); }
+  auto end() const { return values->end(); }
+};
+
+long Sum(Iterable::AnyRange<int, 16> range) {
+  long sum = 0;
+  for (int value : range) {
+    sum += value;
+  }
+  return sum;
+}
+
+void ErasesContainers() {
+  Indexed indexed;
+  indexed.values.resize(1000);
+  std::iota(indexed.values.begin(), indexed.values.end(), 0);
+  CHECK(Sum(indexed) == 999 * 1000 / 2);
+  std::list<int> list{1, 2, 3};
+  CHECK(Sum(list) == 6);
+  CHECK(Sum(std::vector<int>{4, 5}) == 9);
+  std::vector<int> ones(100, 1);
+  CHECK(Sum(Huge{&ones, {}}) == 100);
+  Iterable::AnyRange<int> empty(std::vector<int>{});
+  CHECK(empty.begin() == empty.end());
+}
+
+void Batches() {
+  Indexed indexed;
+  indexed.values.resize(1000);
+  std::iota(indexed.values.begin(), indexed.values.end(), 0);
+  Iterable::AnyRange<int> range(indexed);
+  int buffer[300];
+  std::size_t total = 0;
+  for (auto batch = range.NextBatch(Iterable::Range<int *>(buffer, buffer + 300)); !batch.empty();
+       batch = range.NextBatch(Iterable::Range<int *>(buffer, buffer + 300))) {
+    total += batch.size();
+  }
+  CHECK(total == 1000);
+}
+
+void MovesRestart() {
+  Indexed indexed;
+  indexed.values.resize(1000);
+  std::iota(indexed.values.begin(), indexed.values.end(), 0);
+  Iterable::AnyRange<int> source(indexed);
+  int buffer[4];
+  source.NextBatch(Iterable::Range<int *>(buffer, buffer + 4));
+  Iterable::AnyRange<int> moved = std::move(source);
+  CHECK(moved.NextBatch(Iterable::Range<int *>(buffer, buffer + 4)).size() == 4);
+  CHECK(buffer[0] == 0);
+  // Every begin() restarts the traversal
+  long sum = 0;
+  for (int value : moved) {
+    sum += value;
+  }
+  CHECK(sum == 999 * 500);
+
+  std::vector<int> values{1, 2, 3, 4, 5};
+  using Small = Iterable::AnyRange<int, 2, 8>; // Too small to hold the vector inline
+  Small heap(values);
+  auto it = heap.begin();
+  ++it;
+  ++it;
+  CHECK(heap.NextBatch(Iterable::Range<int *>(buffer, buffer + 4)).size() == 1);
+  Small second(std::move(heap));
+  auto batch = second.NextBatch(Iterable::Range<int *>(buffer, buffer + 4));
+  CHECK(batch.size() == 4);
+  CHECK(buffer[0] == 1);
+  Small third(std::move(second));
+  sum = 0;
+  for (int value : third) {
+    sum += value;
+  }
+  CHECK(sum == 15);
+  moved = Iterable::AnyRange<int>(std::vector<int>{});
+  CHECK(moved.begin() == moved.end());
+}
+} // namespace
+
+int main() {
+  ErasesContainers();
+  Batches();
+  MovesRestart();
+  return Test::Result();
+}
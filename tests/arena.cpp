@@ -0,0 +1,93 @@
+// Arena, ArenaVector and PoolArray allocation and reuse
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <iterable/arena.h>
+#include "test.h"
+
+namespace {
+void AllocatesInRounds() {
+  Iterable::Arena arena(4096);
+  std::size_t capacity = 0;
+  for (int round = 0; round < 3; round++) {
+    {
+      Iterable::ArenaVector<int> values(arena);
+      for (int value = 0; value < 5000; value++) {
+        values.Append(value);
+      }
+      CHECK(values.Length() == 5000);
+      CHECK(reinterpret_cast<std::uintptr_t>(values.Data()) % Iterable::CacheLine == 0);
+      CHECK(std::accumulate(values.begin(), values.end(), 0L) == 4999L * 5000 / 2);
+
+      Iterable::ArenaVector<std::string> strings(arena, 2);
+      for (int value = 0; value < 100; value++) {
+        strings.Append(std::to_string(value));
+      }
+      CHECK(strings[99] == "99");
+      auto moved = std::move(strings);
+      CHECK(moved.Length() == 100);
+      CHECK(strings.Length() == 0);
+
+      Iterable::PoolArray<double> filled(arena, 100, 1.5);
+      CHECK(std::accumulate(filled.begin(), filled.end(), 0.0) == 150);
+      const auto &constant = filled;
+      CHECK(constant[3] == 1.5);
+      Iterable::PoolArray<int> zeroed(arena, 10);
+      CHECK(std::accumulate(zeroed.begin(), zeroed.end(), 0) == 0);
+    }
+    // Reset keeps the blocks, so later rounds allocate nothing new
+    if (round == 0) {
+      capacity = arena.Capacity();
+    }
+    CHECK(arena.Capacity() == capacity);
+    arena.Reset();
+  }
+  Iterable::Arena moved = std::move(arena);
+  Iterable::PoolArray<char> empty(moved, 0);
+  CHECK(empty.Length() == 0);
+}
+
+void AppendsOwnElements() {
+  Iterable::Arena arena;
+  Iterable::ArenaVector<std::string> strings(arena);
+  const std::string value(40, 'a');
+  strings.Append(value);
+  // The argument lives in the storage that growing relocates
+  for (int count = 0; count < 20; count++) {
+    strings.Append(strings[0]);
+  }
+  CHECK(strings.Length() == 21);
+  bool equal = true;
+  for (const auto &string : strings) {
+    equal = equal && string == value;
+  }
+  CHECK(equal);
+}
+
+void RejectsHugeSizes() {
+  constexpr auto Max = std::numeric_limits<std::size_t>::max();
+  Iterable::Arena arena(4096);
+  auto *small = static_cast<char *>(arena.Allocate(16));
+  // Sizes that would wrap the end of the current block or the block size
+  CHECK_THROWS(arena.Allocate(Max - 50), std::bad_alloc);
+  CHECK_THROWS(arena.Allocate(Max), std::bad_alloc);
+  CHECK_THROWS(arena.AllocateArray<char>(Max - 50), std::bad_alloc);
+  CHECK_THROWS(arena.AllocateArray<int>(Max / 2), std::bad_alloc);
+  CHECK_THROWS(Iterable::Arena().Allocate(Max - 8), std::bad_alloc);
+  // The arena is still usable and hands out fresh memory
+  auto *next = static_cast<char *>(arena.Allocate(16));
+  CHECK(next >= small + 16);
+  CHECK(arena.Allocate(8192) != nullptr);
+}
+} // namespace
+
+int main() {
+  AllocatesInRounds();
+  AppendsOwnElements();
+  RejectsHugeSizes();
+  return Test::Result();
+}
@@ -0,0 +1,142 @@
+// AsyncIterator, ForEachAsync and SyncWait over lazy and threaded page sources
+#include <iterable/async.h>
+#include "test.h"
+
+#if ITERABLE_COROUTINES
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+struct Remote {
+  int pages = 3;
+  int fetched = 0; ///< Fetches whose body has run
+
+  Iterable::Task<std::vector<int>> Fetch(std::size_t page) {
+    fetched++;
+    if (static_cast<int>(page) >= pages) {
+      co_return std::vector<int>{};
+    }
+    co_return std::vector<int>{static_cast<int>(page) * 10, static_cast<int>(page) * 10 + 1};
+  }
+};
+
+// Eager awaitable resuming the coroutine from the thread that produced the page
+struct FutureAwaiter {
+  std::shared_future<std::vector<int>> page;
+  std::atomic<int> *resumed;
+
+  bool await_ready() { return page.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+  void await_suspend(std::coroutine_handle<> handle) {
+    std::thread([page = page, handle, resumed = resumed] {
+      page.wait();
+      handle.resume();
+      (*resumed)++;
+    }).detach();
+  }
+  std::vector<int> await_resume() { return page.get(); }
+};
+
+struct Threaded {
+  std::atomic<int> started{0};
+  std::atomic<int> resumed{0};
+  std::chrono::milliseconds delay{0}; ///< Latency of every page after the first
+
+  FutureAwaiter Fetch(std::size_t page) {
+    started++;
+    return {std::async(std::launch::async, [page, delay = delay] {
+              if (page > 0) {
+                std::this_thread::sleep_for(delay);
+              }
+              return page < 4 ? std::vector<int>(100, 1) : std::vector<int>{};
+            }).share(),
+            &resumed};
+  }
+};
+
+struct Failing {
+  Iterable::Task<std::vector<int>> Fetch(std::size_t page) {
+    if (page == 1) {
+      throw std::runtime_error("fetch");
+    }
+    co_return std::vector<int>{1};
+  }
+};
+
+Iterable::Task<int> Sum(Remote &remote) {
+  auto it = Iterable::AsyncBegin(remote);
+  int sum = 0;
+  while (int *value = co_await it.Next()) {
+    sum += *value;
+  }
+  co_return sum;
+}
+
+void IteratesPages() {
+  Remote remote;
+  CHECK(SyncWait(Sum(remote)) == 0 + 1 + 10 + 11 + 20 + 21);
+  Remote empty;
+  empty.pages = 0;
+  CHECK(SyncWait(Sum(empty)) == 0);
+}
+
+// Page N + 1 is fetched while page N is consumed, and elements within a page are ready at once
+Iterable::Task<bool> Overlaps(Remote &remote) {
+  auto it = Iterable::AsyncBegin(remote);
+  bool overlapped = true;
+  bool ready = true;
+  int *value = co_await it.Next();
+  while (value) {
+    overlapped = overlapped && remote.fetched == *value / 10 + 2;
+    auto next = it.Next();
+    if (*value % 10 == 0) {
+      ready = ready && next.await_ready();
+    }
+    value = co_await next;
+  }
+  co_return overlapped && ready && remote.fetched == 4;
+}
+
+void PrefetchesNextPage() {
+  Remote remote;
+  CHECK(SyncWait(Overlaps(remote)));
+}
+
+void CompletesOnOtherThreads() {
+  Threaded threaded;
+  long sum = 0;
+  SyncWait(Iterable::ForEachAsync(threaded, [&](int value) { sum += value; }));
+  CHECK(sum == 400);
+  CHECK(threaded.started == 5);
+}
+
+void PropagatesExceptions() {
+  Failing failing;
+  CHECK_THROWS(SyncWait(Iterable::ForEachAsync(failing, [](int) {})), std::runtime_error);
+
+  // Stopping while the next page is still in flight abandons its fetch
+  Threaded threaded;
+  threaded.delay = std::chrono::milliseconds(20);
+  CHECK_THROWS(SyncWait(Iterable::ForEachAsync(threaded, [](int) { throw std::runtime_error("element"); })),
+               std::runtime_error);
+  CHECK(threaded.started == 2);
+  while (threaded.resumed != 1) {
+    std::this_thread::yield();
+  }
+}
+} // namespace
+
+int main() {
+  IteratesPages();
+  PrefetchesNextPage();
+  CompletesOnOtherThreads();
+  PropagatesExceptions();
+  return Test::Result();
+}
+#else
+int main() { return Test::Skipped; }
+#endif
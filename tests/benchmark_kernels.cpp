@@ -0,0 +1,62 @@
+// Benchmark containers and the vectorization kernels of benchmark/codegen.cpp,
+// which must compute the same results over every container type
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+#include "../benchmark/containers.h"
+#include "test.h"
+
+int SumIndexed(const Bench::Indexed &container);
+int SumContiguous(const Bench::Contiguous &container);
+int SumPointer(const Bench::Pointer &container);
+int SumPassthrough(const Bench::Passthrough &container);
+void ScaleIndexed(Bench::Indexed &container);
+void ScalePointer(Bench::Pointer &container);
+
+namespace {
+constexpr std::size_t Length = 1000;
+
+// Fills with 0, 1, ... and checks the container against a vector
+template <typename C>
+C MakeSequence() {
+  auto container = Bench::Make<C>(Length);
+  CHECK(std::all_of(container.begin(), container.end(), [](int value) { return value == 0; }));
+  std::iota(container.begin(), container.end(), 0);
+  std::vector<int> expected(Length);
+  std::iota(expected.begin(), expected.end(), 0);
+  CHECK(std::equal(container.begin(), container.end(), expected.begin(), expected.end()));
+  CHECK(static_cast<std::size_t>(std::distance(container.begin(), container.end())) == Length);
+  return container;
+}
+
+void ContainersMatchVector() {
+  MakeSequence<Bench::Indexed>();
+  MakeSequence<Bench::Contiguous>();
+  MakeSequence<Bench::Pointer>();
+  MakeSequence<Bench::Passthrough>();
+  MakeSequence<Bench::Raw>();
+  MakeSequence<Bench::Vector>();
+}
+
+void KernelsComputeResults() {
+  constexpr int Sum = static_cast<int>(Length * (Length - 1) / 2);
+  CHECK(SumIndexed(MakeSequence<Bench::Indexed>()) == Sum);
+  CHECK(SumContiguous(MakeSequence<Bench::Contiguous>()) == Sum);
+  CHECK(SumPointer(MakeSequence<Bench::Pointer>()) == Sum);
+  CHECK(SumPassthrough(MakeSequence<Bench::Passthrough>()) == Sum);
+
+  auto indexed = MakeSequence<Bench::Indexed>();
+  ScaleIndexed(indexed);
+  auto pointer = MakeSequence<Bench::Pointer>();
+  ScalePointer(pointer);
+  CHECK(std::equal(indexed.begin(), indexed.end(), pointer.begin(), pointer.end()));
+  CHECK(indexed.values[1] == 3 && indexed.values[Length - 1] == static_cast<int>(3 * (Length - 1)));
+}
+} // namespace
+
+int main() {
+  ContainersMatchVector();
+  KernelsComputeResults();
+  return Test::Result();
+}
@@ -0,0 +1,140 @@
+// ITERABLE_CHECKED iterator assertions, with failures observed in a forked child
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#define ITERABLE_TEST_FORK 1
+#endif
+
+namespace {
+struct Vector : Iterable::For<Vector> {
+  std::vector<int> values;
+  std::size_t generation = 0;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+  std::size_t Generation() const { return generation; }
+  void Push(int value) {
+    values.push_back(value);
+    ++generation;
+  }
+};
+
+struct Column : Iterable::For<Column, Iterable::Strided> {
+  int values[10]{};
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return 5; }
+  static constexpr std::size_t Stride() { return 2; }
+};
+
+// Bounds-checked, so an iterator indexing past the end throws
+struct Contiguous : Iterable::For<Contiguous, Iterable::Contiguous> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values.at(index); }
+  const int &operator[](std::size_t index) const { return values.at(index); }
+  std::size_t Length() const { return values.size(); }
+};
+
+#if ITERABLE_TEST_FORK
+// Whether the function aborts, which is how ITERABLE_ASSERT reports a violation
+template <typename F>
+bool Aborts(F function) {
+  pid_t child = fork();
+  if (child == 0) {
+    std::freopen("/dev/null", "w", stderr);
+    function();
+    _exit(0);
+  }
+  int status = 0;
+  waitpid(child, &status, 0);
+  return WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT;
+}
+#endif
+
+void ValidUse() {
+  Vector vector;
+  vector.values = {3, 1, 2};
+  std::sort(vector.begin(), vector.end());
+  CHECK(std::is_sorted(vector.begin(), vector.end()));
+  int sum = 0;
+  for (int value : vector.Counted()) {
+    sum += value;
+  }
+  CHECK(sum == 6);
+  sum = 0;
+  for (auto it = vector.rbegin(); it != vector.rend(); ++it) {
+    sum += *it;
+  }
+  CHECK(sum == 6);
+  // Fresh iterators are valid after invalidation
+  vector.Push(5);
+  CHECK(std::accumulate(vector.begin(), vector.end(), 0) == 11);
+
+  Column column;
+  for (int &value : column) {
+    value = 1;
+  }
+  CHECK(std::accumulate(column.values, column.values + 10, 0) == 5);
+
+  Contiguous contiguous;
+  contiguous.values = {1, 2, 3};
+  std::vector<int> out(3);
+  std::copy(contiguous.begin(), contiguous.end(), out.begin());
+  CHECK(out == contiguous.values);
+#if ITERABLE_CPP_20
+  CHECK(std::to_address(contiguous.end()) == contiguous.values.data() + 3);
+  CHECK(std::to_address(contiguous.begin()) == contiguous.values.data());
+  const Contiguous &constant = contiguous;
+  CHECK(std::to_address(constant.end()) - std::to_address(constant.begin()) == 3);
+  Contiguous empty;
+  CHECK(std::to_address(empty.begin()) == std::to_address(empty.end()));
+#endif
+}
+
+void InvalidUseAborts() {
+#if ITERABLE_TEST_FORK
+  Vector vector;
+  vector.values = {1, 2, 3};
+  Vector other;
+  other.values = {1};
+  Column column;
+  CHECK(Aborts([&] { return *vector.end(); }));
+  CHECK(Aborts([&] { return vector.begin() == other.begin(); }));
+  CHECK(Aborts([&] {
+    auto it = vector.begin();
+    vector.Push(4);
+    return *it;
+  }));
+  CHECK(Aborts([&] { return *(column.begin() + 5); }));
+  CHECK(Aborts([] {
+    Iterable::Iterator<Vector> it;
+    return *it;
+  }));
+  CHECK(!Aborts([&] { return *(vector.end() - 1); }));
+  std::vector<int> inside{2, 0};
+  std::vector<int> past{0, 3};
+  std::vector<int> negative{-1};
+  CHECK(!Aborts([&] { return *vector.Select(inside).begin(); }));
+  CHECK(Aborts([&] { return *vector.Select(past).begin(); }));
+  CHECK(Aborts([&] { return *vector.Select(negative).begin(); }));
+#endif
+}
+} // namespace
+
+int main() {
+  ValidUse();
+  InvalidUseAborts();
+  return Test::Result();
+}
@@ -0,0 +1,103 @@
+// Standard iterator conformance of Tag::Default and Tag::Contiguous, as
+// relied on by parallel STL backends to split ranges
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+#if ITERABLE_TEST_EXECUTION
+#include <execution>
+#endif
+
+namespace {
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct Contiguous : Iterable::For<Contiguous, Iterable::Contiguous> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+template <typename C>
+using Mutable = decltype(std::declval<C &>().begin());
+
+template <typename C>
+using Constant = decltype(std::declval<const C &>().begin());
+
+template <typename I, typename Reference, typename Pointer>
+constexpr bool RandomAccess() {
+  using Traits = std::iterator_traits<I>;
+  static_assert(std::is_same_v<typename Traits::iterator_category, std::random_access_iterator_tag>);
+  static_assert(std::is_same_v<typename Traits::value_type, int>);
+  static_assert(std::is_same_v<typename Traits::difference_type, std::ptrdiff_t>);
+  static_assert(std::is_same_v<typename Traits::reference, Reference>);
+  static_assert(std::is_same_v<typename Traits::pointer, Pointer>);
+  static_assert(std::is_same_v<decltype(*std::declval<I &>()), Reference>);
+#if ITERABLE_CPP_20
+  static_assert(std::random_access_iterator<I>);
+  static_assert(std::sentinel_for<I, I>);
+  static_assert(std::sized_sentinel_for<I, I>);
+#endif
+  return true;
+}
+
+static_assert(RandomAccess<Mutable<Indexed>, int &, int *>());
+static_assert(RandomAccess<Constant<Indexed>, const int &, const int *>());
+static_assert(RandomAccess<Mutable<Contiguous>, int &, int *>());
+static_assert(RandomAccess<Constant<Contiguous>, const int &, const int *>());
+#if ITERABLE_CPP_20
+static_assert(std::contiguous_iterator<Mutable<Contiguous>>);
+static_assert(std::contiguous_iterator<Constant<Contiguous>>);
+static_assert(std::ranges::random_access_range<Indexed>);
+static_assert(std::ranges::contiguous_range<Contiguous>);
+#endif
+
+template <typename C>
+void Sorts() {
+  std::mt19937 generator(5);
+  C container;
+  container.values.resize(100000);
+  for (auto &value : container.values) {
+    value = static_cast<int>(generator() % 100000);
+  }
+  auto expected = container.values;
+  std::sort(expected.begin(), expected.end());
+  auto shuffled = container.values;
+
+  std::sort(container.begin(), container.end());
+  CHECK(container.values == expected);
+  const C &constant = container;
+  CHECK(std::is_sorted(constant.begin(), constant.end()));
+  CHECK(std::lower_bound(constant.begin(), constant.end(), expected[500]) - constant.begin() <= 500);
+
+#if ITERABLE_TEST_EXECUTION
+  container.values = shuffled;
+  std::sort(std::execution::par, container.begin(), container.end());
+  CHECK(container.values == expected);
+  std::for_each(std::execution::par, container.begin(), container.end(), [](int &value) { value = 1; });
+  CHECK(std::reduce(std::execution::par, constant.begin(), constant.end(), 0L) == 100000);
+#else
+  (void)shuffled;
+#endif
+}
+} // namespace
+
+int main() {
+  Sorts<Indexed>();
+  Sorts<Contiguous>();
+  return Test::Result();
+}
@@ -0,0 +1,133 @@
+// Constant evaluation of For iteration, checked with static_assert
+#include <cstddef>
+#include <cstdint>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+template <Iterable::Tag T>
+struct Table : Iterable::For<Table<T>, T> {
+  std::uint32_t values[256] = {};
+
+  constexpr std::uint32_t &operator[](std::size_t index) { return values[index]; }
+  constexpr const std::uint32_t &operator[](std::size_t index) const { return values[index]; }
+  static constexpr std::size_t Length() { return 256; }
+};
+
+/// Table interleaved with padding, iterated through `Tag::Strided`
+struct Interleaved : Iterable::For<Interleaved, Iterable::Strided> {
+  std::uint32_t values[512] = {};
+
+  constexpr std::uint32_t &operator[](std::size_t index) { return values[index]; }
+  constexpr const std::uint32_t &operator[](std::size_t index) const { return values[index]; }
+  static constexpr std::size_t Length() { return 256; }
+  static constexpr std::size_t Stride() { return 2; }
+};
+
+// CRC-32 lookup table written through the iterators
+template <typename C>
+constexpr C Crc() {
+  C table;
+  std::uint32_t index = 0;
+  for (auto &entry : table) {
+    std::uint32_t crc = index++;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = crc & 1 ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+    }
+    entry = crc;
+  }
+  return table;
+}
+
+// Exercises the iterator operations on a table
+template <typename C>
+constexpr std::uint32_t Checksum(const C &table) {
+  std::uint32_t sum = 0;
+  for (auto value : table.Counted()) {
+    sum += value;
+  }
+  for (auto it = table.rbegin(); it != table.rend(); it++) {
+    sum ^= *it;
+  }
+  auto it = table.begin();
+  it++;
+  it--;
+  it += 3;
+  sum += it[2] + static_cast<std::uint32_t>(table.end() - it) + *(2 + it);
+  for (auto value : table.Slice(10, 20)) {
+    sum -= value;
+  }
+  return sum;
+}
+
+/// Two pages of a split array, iterated through `Tag::Segmented`
+struct Paged : Iterable::For<Paged, Iterable::Segmented> {
+  int first[3] = {1, 2, 3};
+  int second[2] = {4, 5};
+
+  constexpr std::size_t SegmentCount() const { return 3; }
+  constexpr Iterable::Range<const int *> Segment(std::size_t index) const {
+    if (index == 0) {
+      return {first, first + 3};
+    }
+    if (index == 1) {
+      return {second, second};
+    }
+    return {second, second + 2};
+  }
+};
+
+constexpr int PagedSum() {
+  Paged paged;
+  int sum = 0;
+  int count = 0;
+  for (int value : paged) {
+    sum = sum * 10 + value;
+    count++;
+  }
+  return count == 5 ? sum : -1;
+}
+
+struct Constant : Iterable::For<Constant> {
+  int values[4] = {1, 2, 3, 4};
+
+  constexpr const int &operator[](std::size_t index) const { return values[index]; }
+  constexpr std::size_t Length() const { return 4; }
+};
+
+constexpr int ConstantSum() {
+  Constant container;
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  for (auto it = container.begin(); it != container.end(); ++it) {
+    sum += *it;
+  }
+  return sum;
+}
+
+static_assert(ConstantSum() == 20);
+static_assert(PagedSum() == 12345);
+constexpr auto Indexed = Crc<Table<Iterable::Default>>();
+static_assert(Indexed.values[1] == 0x77073096u && Indexed.values[255] == 0x2D02EF8Du);
+constexpr auto Proxied = Crc<Table<Iterable::Proxy>>();
+static_assert(Proxied.values[1] == 0x77073096u);
+static_assert(Checksum(Proxied) == Checksum(Indexed));
+constexpr auto Contiguous = Crc<Table<Iterable::Contiguous>>();
+static_assert(Checksum(Contiguous) == Checksum(Indexed));
+constexpr auto Strided = Crc<Interleaved>();
+static_assert(Strided.values[2] == 0x77073096u && Strided.values[3] == 0);
+static_assert(Checksum(Strided) == Checksum(Indexed));
+} // namespace
+
+int main() {
+  // The same functions at run time
+  auto table = Crc<Table<Iterable::Default>>();
+  CHECK(Checksum(table) == Checksum(Indexed));
+  auto it = table.begin();
+  auto old = it++;
+  CHECK(old.Index() == 0);
+  CHECK(it.Index() == 1);
+  return Test::Result();
+}
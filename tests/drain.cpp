@@ -0,0 +1,117 @@
+// Moving elements out with For::Drain and rvalue begin()/end()
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterable/grid.h>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Strings : Iterable::For<Strings> {
+  std::vector<std::string> values;
+
+  std::string &operator[](std::size_t index) { return values[index]; }
+  const std::string &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct Owners : Iterable::For<Owners, Iterable::Contiguous> {
+  std::vector<std::unique_ptr<int>> values;
+
+  std::unique_ptr<int> &operator[](std::size_t index) { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+  std::unique_ptr<int> *Data() { return values.data(); }
+  const std::unique_ptr<int> *Data() const { return values.data(); }
+};
+
+struct Passthrough : Iterable::For<Passthrough> {
+  std::vector<std::string> data_;
+};
+
+struct Generator : Iterable::For<Generator, Iterable::Input> {
+  int index = 0;
+
+  std::string Next() { return std::string(20, static_cast<char>('a' + index++)); }
+  bool Done() const { return index == 3; }
+};
+
+struct Grid : Iterable::For2D<Grid> {
+  std::vector<std::string> values{std::string(23, 'a'), "b", "c", "d"};
+
+  std::string &operator[](std::size_t index) { return values[index]; }
+  const std::string &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Rows() const { return 2; }
+  std::size_t Cols() const { return 2; }
+};
+
+static_assert(std::is_same_v<decltype(*std::declval<Strings &&>().begin()), std::string &&>);
+static_assert(std::is_same_v<decltype(*std::declval<Strings &>().begin()), std::string &>);
+
+// Long enough to defeat the small string optimization, so a copy is observable
+std::string Long(char fill) { return std::string(30, fill); }
+
+void MovesOut() {
+  Strings strings;
+  strings.values = {Long('x'), Long('y')};
+  auto drain = strings.Drain();
+  std::vector<std::string> out(drain.begin(), drain.end());
+  CHECK(out.size() == 2);
+  CHECK(out[0] == Long('x'));
+  CHECK(strings.values[0].empty());
+
+  strings.values = {Long('z')};
+  std::vector<std::string> moved(std::move(strings).begin(), std::move(strings).end());
+  CHECK(moved[0] == Long('z'));
+  CHECK(strings.values[0].empty());
+
+  Owners owners;
+  owners.values.push_back(std::make_unique<int>(4));
+  owners.values.push_back(std::make_unique<int>(5));
+  auto owned = owners.Drain();
+  std::vector<std::unique_ptr<int>> pointers(owned.begin(), owned.end());
+  CHECK(*pointers[1] == 5);
+  CHECK(!owners.values[0]);
+
+  Passthrough passthrough;
+  passthrough.data_ = {Long('q')};
+  auto drained = passthrough.Drain();
+  std::vector<std::string> values(drained.begin(), drained.end());
+  CHECK(values[0] == Long('q'));
+  CHECK(passthrough.data_[0].empty());
+
+  Generator generator;
+  static_assert(std::is_same_v<decltype(*generator.Drain().begin()), std::string &&>);
+  std::vector<std::string> generated;
+  for (auto &&value : generator.Drain()) {
+    generated.push_back(std::move(value));
+  }
+  CHECK(generated.size() == 3);
+  CHECK(generated[2] == std::string(20, 'c'));
+}
+
+void CopiesOtherwise() {
+  Strings strings;
+  strings.values = {Long('w')};
+  std::vector<std::string> copied(strings.begin(), strings.end());
+  CHECK(strings.values[0] == Long('w'));
+  const Strings &constant = strings;
+  std::vector<std::string> fromConstant(std::move(constant).begin(), std::move(constant).end());
+  CHECK(strings.values[0] == Long('w'));
+
+  // Rvalue views do not own their elements, so they copy
+  Grid grid;
+  auto column = grid.Column(0);
+  std::vector<std::string> fromView(std::move(column).begin(), std::move(column).end());
+  CHECK(fromView[0] == std::string(23, 'a'));
+  CHECK(grid.values[0].size() == 23);
+}
+} // namespace
+
+int main() {
+  MovesOut();
+  CopiesOtherwise();
+  return Test::Result();
+}
@@ -0,0 +1,113 @@
+// Compile-time extents and For::Counted
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Matrix : Iterable::For<Matrix> {
+  float values[16];
+
+  float &operator[](std::size_t index) { return values[index]; }
+  const float &operator[](std::size_t index) const { return values[index]; }
+  static constexpr std::size_t Length() { return 16; }
+};
+
+struct Lanes : Iterable::For<Lanes, Iterable::Contiguous> {
+  static constexpr std::size_t Extent = 8;
+  int values[8];
+
+  int &operator[](std::ptrdiff_t index) { return values[index]; }
+  const int &operator[](std::ptrdiff_t index) const { return values[index]; }
+  int *Data() { return values; }
+  const int *Data() const { return values; }
+};
+
+struct Dynamic : Iterable::For<Dynamic> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct Mutable : Iterable::For<Mutable> {
+  int values[3]{1, 2, 3};
+
+  int &operator[](std::size_t index) { return values[index]; }
+  std::size_t Length() { return 3; }
+};
+
+static_assert(Iterable::Detail::Extent<Matrix> == 16);
+static_assert(Iterable::Detail::Extent<const Lanes> == 8);
+static_assert(Iterable::Detail::Extent<Dynamic> == Iterable::DynamicExtent);
+
+template <typename C>
+using Begin = decltype(std::declval<C &>().begin());
+template <typename C>
+using CountedEnd = decltype(std::declval<C &>().Counted().end());
+
+static_assert(std::is_same_v<CountedEnd<Matrix>, Iterable::Sentinel<std::size_t, 16>>);
+static_assert(std::is_same_v<CountedEnd<const Matrix>, Iterable::Sentinel<std::size_t, 16>>);
+static_assert(std::is_same_v<CountedEnd<Dynamic>, Iterable::Sentinel<std::size_t>>);
+#if ITERABLE_CPP_20
+static_assert(std::sized_sentinel_for<CountedEnd<Matrix>, Begin<Matrix>>);
+static_assert(std::sized_sentinel_for<CountedEnd<const Matrix>, Begin<const Matrix>>);
+static_assert(std::sized_sentinel_for<CountedEnd<Dynamic>, Begin<Dynamic>>);
+static_assert(std::sized_sentinel_for<CountedEnd<const Dynamic>, Begin<const Dynamic>>);
+#endif
+
+void FixedExtents() {
+  Matrix matrix;
+  std::iota(std::begin(matrix.values), std::end(matrix.values), 0.f);
+  auto counted = matrix.Counted();
+  static_assert(decltype(counted.end())::Length() == 16);
+  CHECK(counted.size() == 16);
+  float sum = 0;
+  for (float value : counted) {
+    sum += value;
+  }
+  CHECK(sum == 120.f);
+  CHECK(std::accumulate(matrix.begin(), matrix.end(), 0.f) == 120.f);
+  CHECK(std::is_sorted(matrix.begin(), matrix.end()));
+  const Matrix &constant = matrix;
+  auto constantCounted = constant.Counted();
+  CHECK(constantCounted.end() - constantCounted.begin() == 16);
+#if ITERABLE_CPP_20
+  static_assert(std::ranges::sized_range<decltype(counted)>);
+  CHECK(std::ranges::distance(counted) == 16);
+#endif
+
+  Lanes lanes;
+  std::iota(lanes.values, lanes.values + 8, 1);
+  CHECK(lanes.end() - lanes.begin() == 8);
+  CHECK(std::accumulate(lanes.begin(), lanes.end(), 0) == 36);
+}
+
+void DynamicExtents() {
+  Dynamic dynamic;
+  dynamic.values = {1, 2, 3};
+  CHECK(dynamic.Counted().size() == 3);
+  auto counted = dynamic.Counted();
+  CHECK(counted.end() - counted.begin() == 3);
+  CHECK(counted.begin() - counted.end() == -3);
+  CHECK(std::accumulate(dynamic.begin(), dynamic.end(), 0) == 6);
+  Mutable container;
+  int sum = 0;
+  for (int value : container) {
+    sum += value;
+  }
+  CHECK(sum == 6);
+}
+} // namespace
+
+int main() {
+  FixedExtents();
+  DynamicExtents();
+  return Test::Result();
+}
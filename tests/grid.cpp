@@ -0,0 +1,136 @@
+// For2D rows, columns and tiles
+#include <cstddef>
+#include <numeric>
+#include <vector>
+#include <iterable/grid.h>
+#include <iterable/parallel.h>
+#include "test.h"
+
+namespace {
+struct Matrix : Iterable::For2D<Matrix> {
+  std::size_t rows;
+  std::size_t cols;
+  std::vector<int> values;
+
+  Matrix(std::size_t rows, std::size_t cols) : rows(rows), cols(cols), values(rows * cols) {}
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Rows() const { return rows; }
+  std::size_t Cols() const { return cols; }
+};
+
+struct Image : Iterable::For2D<Image, Iterable::Contiguous> {
+  std::vector<float> values = std::vector<float>(12);
+
+  float &operator[](std::size_t index) { return values[index]; }
+  const float &operator[](std::size_t index) const { return values[index]; }
+  float *Data() { return values.data(); }
+  const float *Data() const { return values.data(); }
+  std::size_t Rows() const { return 3; }
+  std::size_t Cols() const { return 4; }
+};
+
+void RowsAndColumns() {
+  Matrix matrix(5, 7);
+  std::iota(matrix.begin(), matrix.end(), 0);
+  CHECK(matrix.Length() == 35);
+  CHECK(matrix.At(2, 3) == 17);
+  int sum = 0;
+  for (int value : matrix.Row(2)) {
+    sum += value;
+  }
+  CHECK(sum == 14 * 7 + 21);
+  std::vector<int> column;
+  for (int value : matrix.Column(3)) {
+    column.push_back(value);
+  }
+  CHECK((column == std::vector<int>{3, 10, 17, 24, 31}));
+  for (int &value : matrix.Column(0)) {
+    value = -1;
+  }
+  CHECK(matrix.At(4, 0) == -1);
+  CHECK(matrix.At(4, 1) == 29);
+
+  Image image;
+  std::iota(image.values.begin(), image.values.end(), 0.f);
+  float total = 0;
+  for (float value : image.Row(1)) {
+    total += value;
+  }
+  CHECK(total == 4 + 5 + 6 + 7);
+}
+
+void TilesCoverTheGrid() {
+  Matrix matrix(5, 7);
+  std::iota(matrix.begin(), matrix.end(), 0);
+  Matrix transposed(7, 5);
+  int visited = 0;
+  auto tiles = matrix.Tiles<2, 3>();
+  CHECK(tiles.Length() == 3 * 3);
+  for (auto tile : tiles) {
+    for (std::size_t row = 0; row < tile.Rows(); row++) {
+      for (std::size_t col = 0; col < tile.Cols(); col++) {
+        transposed.At(tile.ColFirst() + col, tile.RowFirst() + row) = tile.At(row, col);
+        visited++;
+      }
+    }
+    for (auto row : tile) {
+      CHECK(static_cast<std::size_t>(row.size()) == tile.Cols());
+    }
+  }
+  CHECK(visited == 35);
+  bool matches = true;
+  for (std::size_t row = 0; row < 5; row++) {
+    for (std::size_t col = 0; col < 7; col++) {
+      matches = matches && transposed.At(col, row) == matrix.At(row, col);
+    }
+  }
+  CHECK(matches);
+
+  const Matrix &constant = matrix;
+  long sum = 0;
+  for (auto tile : constant.Tiles<4>()) {
+    for (auto row : tile) {
+      for (int value : row) {
+        sum += value;
+      }
+    }
+  }
+  CHECK(sum == 34 * 35 / 2);
+
+  Image image;
+  for (auto tile : image.Tiles<2, 2>()) {
+    for (auto row : tile) {
+      for (float &value : row) {
+        value += 1;
+      }
+    }
+  }
+  CHECK(std::accumulate(image.values.begin(), image.values.end(), 0.f) == 12);
+
+  Matrix empty(0, 0);
+  auto none = empty.Tiles<4>();
+  CHECK(none.begin() == none.end());
+}
+
+void TilesInParallel() {
+  Matrix matrix(5, 7);
+  Iterable::ThreadPool pool(3);
+  auto tiles = matrix.Tiles<2>();
+  Iterable::ParallelFor(tiles, [](auto tile) {
+    for (auto row : tile) {
+      for (int &value : row) {
+        value = 1;
+      }
+    }
+  }, 1, pool);
+  CHECK(std::accumulate(matrix.begin(), matrix.end(), 0) == 35);
+}
+} // namespace
+
+int main() {
+  RowsAndColumns();
+  TilesCoverTheGrid();
+  TilesInParallel();
+  return Test::Result();
+}
@@ -0,0 +1,67 @@
+// Index types deduced from Length(), including unsigned 32-bit lengths
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Narrow : Iterable::For<Narrow> {
+  std::vector<int> values{1, 2, 3};
+
+  int &operator[](unsigned index) { return values[index]; }
+  const int &operator[](unsigned index) const { return values[index]; }
+  unsigned Length() const { return static_cast<unsigned>(values.size()); }
+};
+
+struct Wide : Iterable::For<Wide> {
+  std::vector<int> values{1, 2, 3};
+
+  int &operator[](std::uint64_t index) { return values[index]; }
+  const int &operator[](std::uint64_t index) const { return values[index]; }
+  std::uint64_t Length() const { return values.size(); }
+};
+
+static_assert(std::is_same_v<std::decay_t<decltype(std::declval<Narrow &>().begin().Index())>, unsigned>);
+static_assert(std::is_same_v<std::decay_t<decltype(std::declval<Wide &>().begin().Index())>, std::uint64_t>);
+
+// Differences are signed whatever the index type
+template <typename C>
+void SignedDifferences() {
+  C container;
+  auto first = container.begin();
+  auto last = first + 3;
+  CHECK(last - first == 3);
+  CHECK(first - last == -3);
+  CHECK(std::distance(last, first) == -3);
+  CHECK(container.begin() - container.end() == -3);
+  CHECK(container.end() - container.begin() == 3);
+  CHECK(first < last && !(last < first));
+  CHECK(last > first && first <= last && !(first >= last));
+  CHECK(*(last - 1) == 3);
+  CHECK(last[-3] == 1);
+
+  auto rfirst = container.rbegin();
+  auto rlast = container.rend();
+  CHECK(rlast - rfirst == 3);
+  CHECK(rfirst - rlast == -3);
+  CHECK(rfirst < rlast);
+  CHECK(!(rlast < rfirst));
+  CHECK(rlast > rfirst && rfirst <= rlast && !(rfirst >= rlast));
+  std::vector<int> reversed(rfirst, rlast);
+  CHECK((reversed == std::vector<int>{3, 2, 1}));
+
+  std::sort(container.begin(), container.end(), [](int a, int b) { return a > b; });
+  CHECK((container.values == std::vector<int>{3, 2, 1}));
+}
+} // namespace
+
+int main() {
+  SignedDifferences<Narrow>();
+  SignedDifferences<Wide>();
+  return Test::Result();
+}
@@ -0,0 +1,85 @@
+// Tag::Input single-pass iteration over Done() and Next()
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Counter : Iterable::For<Counter, Iterable::Input> {
+  int index = 0;
+  int count;
+
+  explicit Counter(int count) : count(count) {}
+  bool Done() const { return index == count; }
+  int Next() { return index++; }
+};
+
+struct Lines : Iterable::For<Lines, Iterable::Input> {
+  std::vector<std::string> source;
+  std::size_t position = 0;
+  std::string buffer;
+
+  bool Done() const { return position == source.size(); }
+  std::string &Next() {
+    buffer = source[position++];
+    return buffer;
+  }
+};
+
+struct Owners : Iterable::For<Owners, Iterable::Input> {
+  int index = 0;
+
+  bool Done() const { return index == 3; }
+  std::unique_ptr<int> Next() { return std::make_unique<int>(index++); }
+};
+
+void ReadsValues() {
+  Counter counter(5);
+  int sum = 0;
+  for (int value : counter) {
+    sum += value;
+  }
+  CHECK(sum == 10);
+  Counter empty(0);
+  CHECK(empty.begin() == empty.end());
+
+  Counter stepped(3);
+  auto it = stepped.begin();
+  CHECK(*it++ == 0);
+  CHECK(*it == 1);
+#if ITERABLE_CPP_20
+  static_assert(std::input_iterator<decltype(counter.begin())>);
+  static_assert(std::sentinel_for<Iterable::ViewEnd, decltype(counter.begin())>);
+#endif
+}
+
+void ReadsReferencesAndMoveOnlyValues() {
+  Lines lines;
+  lines.source = {"a", "bc"};
+  std::string all;
+  for (auto &line : lines) {
+    all += line;
+  }
+  CHECK(all == "abc");
+
+  Owners owners;
+  std::vector<std::unique_ptr<int>> out;
+  for (auto &owner : owners) {
+    out.push_back(std::move(owner));
+  }
+  CHECK(out.size() == 3);
+  CHECK(*out[2] == 2);
+#if ITERABLE_CPP_20
+  static_assert(std::input_iterator<decltype(owners.begin())>);
+#endif
+}
+} // namespace
+
+int main() {
+  ReadsValues();
+  ReadsReferencesAndMoveOnlyValues();
+  return Test::Result();
+}
@@ -0,0 +1,97 @@
+// Instrumented iteration counters and the StatsRegistry
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Hot : Iterable::For<Hot, Iterable::Default, Iterable::Instrumented> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct Pointer : Iterable::For<Pointer, Iterable::Contiguous, Iterable::Instrumented> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+  int *Data() { return values.data(); }
+  const int *Data() const { return values.data(); }
+};
+
+struct Cold : Iterable::For<Cold> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+// Uninstrumented types keep the plain iterator
+static_assert(std::is_same_v<decltype(std::declval<Cold &>().begin()), Iterable::Iterator<Cold>>);
+
+void CountsTraversals() {
+  Hot hot;
+  hot.values.resize(100);
+  std::iota(hot.values.begin(), hot.values.end(), 0);
+  long sum = 0;
+  for (int value : hot) {
+    sum += value;
+  }
+  const Hot &constant = hot;
+  for (int value : constant) {
+    sum += value;
+  }
+  CHECK(sum == 2 * 4950);
+  auto &stats = Iterable::Stats<Hot>();
+  CHECK(stats.begins == 2);
+  CHECK(stats.ends == 2);
+  CHECK(stats.elements == 200);
+
+  // Algorithms and adapters still work through the instrumented iterator
+  std::sort(hot.begin(), hot.end(), std::greater<>());
+  CHECK(hot.values[0] == 99);
+  sum = 0;
+  for (auto it = hot.rbegin(); it != hot.rend(); ++it) {
+    sum += *it;
+  }
+  CHECK(sum == 4950);
+  sum = 0;
+  for (int value : hot.Map([](int x) { return x * 2; })) {
+    sum += value;
+  }
+  CHECK(sum == 2 * 4950);
+
+  Pointer pointer;
+  pointer.values.assign(10, 1);
+  CHECK(std::accumulate(pointer.begin(), pointer.end(), 0) == 10);
+  CHECK(Iterable::Stats<Pointer>().elements >= 10);
+}
+
+void RegistryListsTypes() {
+  int count = 0;
+  bool named = true;
+  Iterable::StatsRegistry::Global().ForEach([&](const Iterable::IterationStats &stats) {
+    count++;
+    named = named && stats.name != nullptr;
+  });
+  CHECK(count == 2);
+  CHECK(named);
+  Iterable::StatsRegistry::Global().Reset();
+  CHECK(Iterable::Stats<Hot>().begins == 0);
+  CHECK(Iterable::Stats<Pointer>().elements == 0);
+}
+} // namespace
+
+int main() {
+  CountsTraversals();
+  RegistryListsTypes();
+  return Test::Result();
+}
@@ -0,0 +1,73 @@
+// MappedArray over files written into the test's working directory
+#include <cstdint>
+#include <cstdio>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <iterable/mapped.h>
+#include "test.h"
+
+namespace {
+struct Record {
+  std::uint32_t id;
+  float value;
+};
+
+constexpr const char *RecordsPath = "mapped_records.bin";
+constexpr const char *EmptyPath = "mapped_empty.bin";
+
+void WriteRecords() {
+  FILE *file = std::fopen(RecordsPath, "wb");
+  CHECK(file != nullptr);
+  for (std::uint32_t id = 0; id < 1000; id++) {
+    Record record{id, 0.5f};
+    std::fwrite(&record, sizeof record, 1, file);
+  }
+  // A trailing partial record is ignored
+  std::fputc(1, file);
+  std::fclose(file);
+  file = std::fopen(EmptyPath, "wb");
+  CHECK(file != nullptr);
+  std::fclose(file);
+}
+
+void MapsRecords() {
+  Iterable::MappedArray<Record> records(RecordsPath, Iterable::Sequential, true);
+  static_assert(std::is_same_v<decltype(records.begin()), const Record *>);
+  CHECK(records.Length() == 1000);
+  double sum = 0;
+  for (const Record &record : records) {
+    sum += record.value;
+  }
+  CHECK(sum == 500);
+  records.Advise(Iterable::Random);
+  CHECK(records[999].id == 999);
+
+  auto moved = std::move(records);
+  CHECK(records.Length() == 0);
+  CHECK(moved.Length() == 1000);
+  int chunks = 0;
+  auto view = moved.Chunks<64>();
+  for (auto chunk : view) {
+    CHECK(chunk.size() == 64);
+    chunks++;
+  }
+  CHECK(chunks == 15);
+  CHECK(view.Tail().size() == 1000 - 15 * 64);
+}
+
+void EmptyAndMissingFiles() {
+  Iterable::MappedArray<Record> empty(EmptyPath);
+  CHECK(empty.begin() == empty.end());
+  CHECK_THROWS(Iterable::MappedArray<Record>("mapped_missing.bin"), std::system_error);
+}
+} // namespace
+
+int main() {
+  WriteRecords();
+  MapsRecords();
+  EmptyAndMissingFiles();
+  std::remove(RecordsPath);
+  std::remove(EmptyPath);
+  return Test::Result();
+}
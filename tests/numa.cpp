@@ -0,0 +1,117 @@
+// Topology detection, NumaPool worker placement, FirstTouch and NumaFor
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <iterable/iterable.h>
+#include <iterable/numa.h>
+#include "test.h"
+
+namespace {
+struct Column : Iterable::For<Column> {
+  std::vector<long> values;
+
+  long &operator[](std::size_t index) { return values[index]; }
+  const long &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+  // Uneven node shares, as if the pages had been placed by hand
+  std::size_t NodeBoundary(unsigned node, unsigned nodes) const {
+    return node == 0 ? 0 : values.size() * 3 / 4 * node / (nodes > 1 ? nodes - 1 : 1);
+  }
+};
+
+constexpr long ColumnSum = 4999L * 5000 / 2;
+
+void Topologies() {
+  CHECK((Iterable::Detail::ParseCpuList("0-3,8,10-11\n") == std::vector<unsigned>{0, 1, 2, 3, 8, 10, 11}));
+  CHECK(Iterable::Detail::ParseCpuList("").empty());
+
+  // Detected nodes only hold CPUs this process may run on
+  auto allowed = Iterable::Detail::AllowedCpus();
+  CHECK(!allowed.empty());
+  CHECK(std::is_sorted(allowed.begin(), allowed.end()));
+  auto host = Iterable::Topology::Detect();
+  CHECK(host.CpuCount() > 0);
+  bool subset = true;
+  for (unsigned node = 0; node < host.NodeCount(); node++) {
+    for (auto cpu : host.Cpus(node)) {
+      subset = subset && std::binary_search(allowed.begin(), allowed.end(), cpu);
+    }
+  }
+  CHECK(subset);
+
+  Iterable::Topology fallback({});
+  CHECK(fallback.NodeCount() == 1);
+  CHECK(fallback.Cpus(0) == allowed);
+  CHECK(Iterable::Topology({{0}, {}, {0}}).NodeCount() == 2);
+}
+
+void DistributesWork(unsigned concurrency) {
+  Iterable::NumaPool pool(Iterable::Topology({{0}, {}, {0}}), concurrency);
+  CHECK(pool.NodeCount() == 2);
+  CHECK(pool.Concurrency() == concurrency);
+  CHECK(pool.NodeWorkers(0) + pool.NodeWorkers(1) == concurrency);
+
+  constexpr std::size_t Length = 100003;
+  std::unique_ptr<int[]> raw(new int[Length]);
+  Iterable::FirstTouch(raw.get(), raw.get() + Length, [&](int &value) { value = static_cast<int>(&value - raw.get()); }, pool);
+  bool initialized = true;
+  for (std::size_t index = 0; index < Length; index++) {
+    initialized = initialized && raw[index] == static_cast<int>(index);
+  }
+  CHECK(initialized);
+
+  std::vector<std::atomic<int>> hits(Length);
+  Iterable::NumaFor(raw.get(), raw.get() + Length, [&](int &value) { hits[value]++; }, 0, pool);
+  CHECK(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int> &count) { return count == 1; }));
+
+  Column column;
+  column.values.resize(5000);
+  std::iota(column.values.begin(), column.values.end(), 0);
+  std::atomic<long> sum{0};
+  Iterable::NumaFor(column, [&](long value) { sum += value; }, 7, pool);
+  CHECK(sum == ColumnSum);
+  const Column &constant = column;
+  sum = 0;
+  Iterable::NumaFor(constant, [&](const long &value) { sum += value; }, 0, pool);
+  CHECK(sum == ColumnSum);
+
+  // NumaPool is an executor for the parallel algorithms too
+  CHECK(Iterable::ParallelReduce(column.begin(), column.end(), 0L, std::plus<>(), pool) == ColumnSum);
+  CHECK_THROWS(Iterable::NumaFor(column, [](long value) {
+                 if (value == 4000) {
+                   throw std::runtime_error("element");
+                 }
+               }, 0, pool),
+               std::runtime_error);
+}
+
+void DefaultPool() {
+  std::vector<int> empty;
+  int calls = 0;
+  Iterable::NumaFor(empty.begin(), empty.end(), [&](int) { calls++; });
+  CHECK(calls == 0);
+  std::vector<int> ones(1000, 1);
+  std::atomic<int> sum{0};
+  Iterable::NumaFor(ones.begin(), ones.end(), [&](int value) { sum += value; });
+  CHECK(sum == 1000);
+
+  constexpr std::size_t Length = 1 << 20;
+  std::unique_ptr<double[]> values(new double[Length]);
+  Iterable::FirstTouch(values.get(), values.get() + Length, [](double &value) { value = 1; });
+  CHECK(std::accumulate(values.get(), values.get() + Length, 0.0) == Length);
+}
+} // namespace
+
+int main() {
+  Topologies();
+  for (unsigned concurrency : {1u, 2u, 3u, 5u}) {
+    DistributesWork(concurrency);
+  }
+  DefaultPool();
+  return Test::Result();
+}
@@ -0,0 +1,117 @@
+// ThreadPool and ParallelFor over iterators and containers
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <iterable/iterable.h>
+#include <iterable/parallel.h>
+#include "test.h"
+
+namespace {
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+// Executor running every worker on the calling thread
+struct Inline {
+  unsigned Concurrency() const { return 3; }
+
+  template <typename F>
+  void Run(F &&task) {
+    for (unsigned worker = 0; worker < Concurrency(); worker++) {
+      task(worker);
+    }
+  }
+};
+
+void PoolRunsEveryWorkerOnce() {
+  Iterable::ThreadPool pool(4);
+  CHECK(pool.Concurrency() == 4);
+  std::vector<std::atomic<int>> runs(4);
+  pool.Run([&](unsigned worker) { runs[worker]++; });
+  for (auto &count : runs) {
+    CHECK(count == 1);
+  }
+  CHECK(Iterable::ThreadPool(0).Concurrency() == 1);
+}
+
+void PoolRethrowsFirstException() {
+  Iterable::ThreadPool pool(3);
+  CHECK_THROWS(pool.Run([](unsigned worker) {
+    if (worker == 1) {
+      throw std::runtime_error("worker");
+    }
+  }), std::runtime_error);
+  std::atomic<int> runs{0};
+  pool.Run([&](unsigned) { runs++; });
+  CHECK(runs == 3);
+}
+
+void ForVisitsEveryElementOnce() {
+  for (unsigned threads : {1u, 2u, 5u}) {
+    Iterable::ThreadPool pool(threads);
+    for (std::ptrdiff_t grain : {0, 1, 7, 1000000}) {
+      std::vector<std::atomic<int>> hits(10007);
+      std::vector<int> indices(hits.size());
+      for (std::size_t index = 0; index < indices.size(); index++) {
+        indices[index] = static_cast<int>(index);
+      }
+      Iterable::ParallelFor(indices.begin(), indices.end(), [&](int index) { hits[static_cast<std::size_t>(index)]++; }, grain, pool);
+      CHECK(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int> &count) { return count == 1; }));
+    }
+  }
+}
+
+void ForOverContainers() {
+  Indexed container;
+  container.values.assign(100000, 1);
+  Iterable::ParallelFor(container, [](int &value) { value = 2; });
+  std::atomic<long> sum{0};
+  const Indexed &view = container;
+  Iterable::ParallelFor(view, [&](const int &value) { sum += value; }, 100);
+  CHECK(sum == 200000);
+
+  Inline executor;
+  sum = 0;
+  Iterable::ParallelFor(container, [&](int &value) { sum += value; }, 10, executor);
+  CHECK(sum == 200000);
+
+  std::vector<int> empty;
+  Iterable::ParallelFor(empty, [](int) { CHECK(false); });
+}
+
+void ForNestedRunsSequentially() {
+  Iterable::ThreadPool pool(4);
+  Indexed container;
+  container.values.assign(1000, 1);
+  std::atomic<long> sum{0};
+  Iterable::ParallelFor(container, [&](int &value) {
+    sum += value;
+    Iterable::ParallelFor(container.values.begin(), container.values.begin() + 10, [](int) {}, 1, pool);
+  }, 10, pool);
+  CHECK(sum == 1000);
+}
+
+void ForPropagatesExceptions() {
+  Iterable::ThreadPool pool(4);
+  Indexed container;
+  container.values.assign(1000, 1);
+  CHECK_THROWS(Iterable::ParallelFor(container, [](int &) { throw std::runtime_error("element"); }, 10, pool),
+               std::runtime_error);
+}
+} // namespace
+
+int main() {
+  PoolRunsEveryWorkerOnce();
+  PoolRethrowsFirstException();
+  ForVisitsEveryElementOnce();
+  ForOverContainers();
+  ForNestedRunsSequentially();
+  ForPropagatesExceptions();
+  return Test::Result();
+}
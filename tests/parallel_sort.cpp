@@ -0,0 +1,89 @@
+// ParallelSort and ParallelReduce against their sequential counterparts
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <iterable/iterable.h>
+#include <iterable/parallel.h>
+#include "test.h"
+
+namespace {
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct Contiguous : Iterable::For<Contiguous, Iterable::Contiguous> {
+  std::vector<double> values;
+
+  double &operator[](std::size_t index) { return values[index]; }
+  const double &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+void MatchesSequential(unsigned threads, std::size_t length, std::mt19937 &generator) {
+  Iterable::ThreadPool pool(threads);
+  Indexed indexed;
+  indexed.values.resize(length);
+  for (auto &value : indexed.values) {
+    value = static_cast<int>(generator() % 1000);
+  }
+  auto expected = indexed.values;
+  std::sort(expected.begin(), expected.end());
+  Iterable::ParallelSort(indexed, std::less<>(), pool);
+  CHECK(indexed.values == expected);
+  CHECK(Iterable::ParallelReduce(indexed, 0L, std::plus<>(), pool) == std::accumulate(expected.begin(), expected.end(), 0L));
+
+  Contiguous contiguous;
+  contiguous.values.resize(length);
+  for (auto &value : contiguous.values) {
+    value = static_cast<double>(generator() % 5000);
+  }
+  auto descending = contiguous.values;
+  std::sort(descending.begin(), descending.end(), std::greater<>());
+  Iterable::ParallelSort(contiguous, std::greater<>(), pool);
+  CHECK(contiguous.values == descending);
+
+  std::vector<std::string> strings(length);
+  for (auto &value : strings) {
+    value = std::to_string(generator());
+  }
+  auto sorted = strings;
+  std::sort(sorted.begin(), sorted.end());
+  Iterable::ParallelSort(strings.begin(), strings.end(), std::less<>(), pool);
+  CHECK(strings == sorted);
+
+  // Concatenation is associative but not commutative, so partial results must combine in order
+  std::vector<std::string> letters(length);
+  for (std::size_t index = 0; index < length; index++) {
+    letters[index] = std::string(1, static_cast<char>('a' + index % 26));
+  }
+  CHECK(Iterable::ParallelReduce(letters.begin(), letters.end(), std::string(), std::plus<>(), pool) ==
+        std::accumulate(letters.begin(), letters.end(), std::string()));
+}
+
+void DefaultExecutor() {
+  Indexed indexed;
+  indexed.values = {3, 2, 1};
+  Iterable::ParallelSort(indexed);
+  CHECK((indexed.values == std::vector<int>{1, 2, 3}));
+  CHECK(Iterable::ParallelReduce(indexed, 0) == 6);
+}
+} // namespace
+
+int main() {
+  std::mt19937 generator(1);
+  for (unsigned threads : {1u, 2u, 3u, 4u, 7u}) {
+    for (std::size_t length : {std::size_t{0}, std::size_t{5}, std::size_t{20000}, std::size_t{50003}}) {
+      MatchesSequential(threads, length, generator);
+    }
+  }
+  DefaultExecutor();
+  return Test::Result();
+}
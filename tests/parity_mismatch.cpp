@@ -0,0 +1,33 @@
+// Fixture for check_parity.cmake: SumChecked adds a bounds check its reference
+// loop does not have, so the check must report it (and only it).
+#include <cstddef>
+#include <vector>
+
+extern "C" {
+
+int SumRaw(const std::vector<int> &values) {
+  int sum = 0;
+  for (std::size_t index = 0, length = values.size(); index != length; ++index) {
+    sum += values[index];
+  }
+  return sum;
+}
+
+int SumPointer(const std::vector<int> &values) { // ITERABLE_SAME_AS SumRaw
+  int sum = 0;
+  const int *data = values.data();
+  for (std::size_t index = 0, length = values.size(); index != length; ++index) {
+    sum += *(data + index);
+  }
+  return sum;
+}
+
+int SumChecked(const std::vector<int> &values) { // ITERABLE_SAME_AS SumRaw
+  int sum = 0;
+  for (std::size_t index = 0, length = values.size(); index != length; ++index) {
+    sum += values.at(index + 1);
+  }
+  return sum;
+}
+
+} // extern "C"
@@ -0,0 +1,61 @@
+// For::Prefetched over an indirectly indexed container
+#include <cstddef>
+#include <numeric>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Table : Iterable::For<Table> {
+  std::vector<std::size_t> indices;
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[indices[index]]; }
+  const int &operator[](std::size_t index) const { return values.at(indices.at(index)); }
+  std::size_t Length() const { return indices.size(); }
+};
+
+Table Reversed(int length) {
+  Table table;
+  for (int index = 0; index < length; index++) {
+    table.indices.push_back(length - 1 - index);
+    table.values.push_back(index);
+  }
+  return table;
+}
+
+void VisitsEveryElement() {
+  // The const operator[] bounds-checks, so prefetching past the end would throw
+  const auto table = Reversed(100);
+  long sum = 0;
+  for (int value : table.Prefetched<8>()) {
+    sum += value;
+  }
+  CHECK(sum == 4950);
+  sum = 0;
+  for (int value : table.Prefetched<1000>()) {
+    sum += value;
+  }
+  CHECK(sum == 4950);
+  std::vector<int> out;
+  for (int value : table.Prefetched<4>()) {
+    out.push_back(value);
+  }
+  CHECK(out.front() == 99 && out.back() == 0);
+}
+
+void DefaultDistance() {
+  auto table = Reversed(100);
+  auto range = table.Prefetched();
+  CHECK(range.size() == 100);
+  CHECK(std::accumulate(range.begin(), range.end(), 0L) == 4950);
+  Table empty;
+  CHECK(empty.Prefetched().begin() == empty.Prefetched().end());
+}
+} // namespace
+
+int main() {
+  VisitsEveryElement();
+  DefaultDistance();
+  return Test::Result();
+}
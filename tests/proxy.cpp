@@ -0,0 +1,93 @@
+// Tag::Proxy iteration over computed elements and proxy references
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+/// Packed bits, written through a proxy reference
+struct Bits : Iterable::For<Bits, Iterable::Proxy> {
+  struct Reference {
+    std::uint64_t *word;
+    std::size_t bit;
+
+    operator bool() const { return (*word >> bit) & 1; }
+    Reference &operator=(bool value) {
+      if (value) {
+        *word |= std::uint64_t(1) << bit;
+      } else {
+        *word &= ~(std::uint64_t(1) << bit);
+      }
+      return *this;
+    }
+  };
+
+  std::vector<std::uint64_t> words;
+  std::size_t length = 0;
+
+  Reference operator[](std::size_t index) { return {&words[index / 64], index % 64}; }
+  bool operator[](std::size_t index) const { return (words[index / 64] >> (index % 64)) & 1; }
+  std::size_t Length() const { return length; }
+};
+
+/// Elements computed on access
+struct Squares : Iterable::For<Squares, Iterable::Proxy> {
+  long operator[](std::size_t index) const { return static_cast<long>(index * index); }
+  std::size_t Length() const { return 5; }
+};
+
+void ComputedElements() {
+  Squares squares;
+  CHECK(std::accumulate(squares.begin(), squares.end(), 0L) == 30);
+  CHECK(squares.begin()[4] == 16);
+  CHECK(*(squares.end() - 2) == 9);
+  long sum = 0;
+  for (auto value : squares.Counted()) {
+    sum += value;
+  }
+  CHECK(sum == 30);
+  std::vector<long> out(5);
+  std::copy(squares.begin(), squares.end(), out.begin());
+  CHECK(out[3] == 9);
+  static_assert(std::is_same_v<std::iterator_traits<decltype(squares.begin())>::reference, long>);
+}
+
+void ProxyReferences() {
+  Bits bits;
+  bits.words.assign(3, 0);
+  bits.length = 150;
+  for (auto bit : bits) {
+    bit = true;
+  }
+  const Bits &view = bits;
+  CHECK(std::count(view.begin(), view.end(), true) == 150);
+  bits.begin()[3] = false;
+  CHECK(std::count(view.begin(), view.end(), true) == 149);
+  CHECK(!view.begin()[3] && view.begin()[4]);
+  CHECK(bits.words[2] == (std::uint64_t(1) << 22) - 1);
+}
+
+void RandomAccess() {
+  Squares squares;
+#if ITERABLE_CPP_20
+  static_assert(std::random_access_iterator<decltype(squares.begin())>);
+#endif
+  auto first = squares.begin();
+  auto last = squares.end();
+  CHECK(last - first == 5);
+  CHECK(first + 5 == last && first < last);
+  CHECK(*std::prev(last) == 16);
+}
+} // namespace
+
+int main() {
+  ComputedElements();
+  ProxyReferences();
+  RandomAccess();
+  return Test::Result();
+}
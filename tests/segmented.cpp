@@ -0,0 +1,80 @@
+// Tag::Segmented iteration and the segment-aware for_each and copy
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Paged : Iterable::For<Paged, Iterable::Segmented> {
+  std::vector<std::vector<int>> pages;
+
+  std::size_t SegmentCount() const { return pages.size(); }
+  Iterable::Range<int *> Segment(std::size_t index) {
+    return {pages[index].data(), pages[index].data() + pages[index].size()};
+  }
+  Iterable::Range<const int *> Segment(std::size_t index) const {
+    return {pages[index].data(), pages[index].data() + pages[index].size()};
+  }
+};
+
+Paged Pages() {
+  Paged paged;
+  paged.pages = {{}, {1, 2, 3}, {}, {4}, {5, 6}, {}};
+  return paged;
+}
+
+void SkipsEmptySegments() {
+  auto paged = Pages();
+  std::vector<int> out;
+  for (int value : paged) {
+    out.push_back(value);
+  }
+  CHECK((out == std::vector<int>{1, 2, 3, 4, 5, 6}));
+  const Paged &constant = paged;
+  CHECK(std::accumulate(constant.begin(), constant.end(), 0) == 21);
+  CHECK(std::find(paged.begin(), paged.end(), 4) != paged.end());
+  CHECK(std::find(paged.begin(), paged.end(), 7) == paged.end());
+
+  Paged empty;
+  empty.pages = {{}, {}};
+  CHECK(empty.begin() == empty.end());
+#if ITERABLE_CPP_20
+  static_assert(std::forward_iterator<decltype(constant.begin())>);
+#endif
+}
+
+void SegmentAwareAlgorithms() {
+  auto paged = Pages();
+  const Paged &constant = paged;
+  std::vector<int> out(6);
+  using std::copy;
+  auto end = copy(constant.begin(), constant.end(), out.begin());
+  CHECK(end == out.end());
+  CHECK((out == std::vector<int>{1, 2, 3, 4, 5, 6}));
+
+  int sum = 0;
+  for_each(paged.begin(), paged.end(), [&](int &value) {
+    value *= 2;
+    sum += value;
+  });
+  CHECK(sum == 42);
+
+  auto first = std::next(paged.begin(), 2);
+  auto last = std::next(paged.begin(), 5);
+  sum = 0;
+  for_each(first, last, [&](int value) { sum += value; });
+  CHECK(sum == 6 + 8 + 10);
+  sum = 0;
+  for_each(first, first, [&](int value) { sum += value; });
+  CHECK(sum == 0);
+}
+} // namespace
+
+int main() {
+  SkipsEmptySegments();
+  SegmentAwareAlgorithms();
+  return Test::Result();
+}
@@ -0,0 +1,103 @@
+// For::Select over bitmasks and index lists
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct Passthrough : Iterable::For<Passthrough> {
+  std::vector<int> data_;
+};
+
+template <typename C, typename R, typename = void>
+struct SelectsS {
+  static constexpr bool Value = false;
+};
+
+template <typename C, typename R>
+struct SelectsS<C, R, std::void_t<decltype(std::declval<C>().Select(std::declval<R>()))>> {
+  static constexpr bool Value = true;
+};
+
+// Temporary index lists are rejected, since the view would outlive them
+static_assert(SelectsS<Indexed &, const std::vector<int> &>::Value);
+static_assert(SelectsS<const Indexed &, std::vector<int> &>::Value);
+static_assert(!SelectsS<Indexed &, std::vector<int>>::Value);
+static_assert(!SelectsS<const Indexed &, std::vector<int>>::Value);
+static_assert(!SelectsS<Passthrough &, const std::vector<int> &&>::Value);
+static_assert(SelectsS<Indexed &, Iterable::Bitmask<>>::Value);
+
+template <typename R>
+std::vector<int> Collect(R &&range) {
+  std::vector<int> out;
+  for (int value : range) {
+    out.push_back(value);
+  }
+  return out;
+}
+
+void SelectsBitmasks() {
+  Indexed indexed;
+  indexed.values.resize(200);
+  std::iota(indexed.values.begin(), indexed.values.end(), 0);
+  std::vector<std::uint64_t> words(4, 0);
+  std::vector<int> expected;
+  for (int index = 0; index < 200; index++) {
+    if (index % 7 == 0 || index == 63 || index == 64 || index == 199) {
+      words[index / 64] |= std::uint64_t{1} << (index % 64);
+      expected.push_back(index);
+    }
+  }
+  // Bits past the mask length are ignored
+  words[3] |= std::uint64_t{1} << 20;
+  CHECK(Collect(indexed.Select(Iterable::Bitmask<>(words.data(), 200))) == expected);
+
+  for (int &value : indexed.Select(Iterable::Bitmask<>(words.data(), 200))) {
+    value = -value;
+  }
+  CHECK(indexed.values[7] == -7 && indexed.values[8] == 8);
+  const Indexed &constant = indexed;
+  long sum = 0;
+  for (int value : constant.Select(Iterable::Bitmask<>(words.data(), 200)).Map([](int x) { return -x; })) {
+    sum += value;
+  }
+  CHECK(sum == std::accumulate(expected.begin(), expected.end(), 0L));
+
+  std::vector<std::uint8_t> bytes{0, 0x81};
+  CHECK((Collect(constant.Select(Iterable::Bitmask<std::uint8_t>(bytes.data(), 16))) == std::vector<int>{8, 15}));
+  CHECK(Collect(constant.Select(Iterable::Bitmask<>())).empty());
+  std::vector<std::uint64_t> zero(4, 0);
+  CHECK(Collect(indexed.Select(Iterable::Bitmask<>(zero.data(), 200))).empty());
+}
+
+void SelectsIndices() {
+  Indexed indexed;
+  indexed.values.resize(200);
+  std::iota(indexed.values.begin(), indexed.values.end(), 0);
+  std::vector<std::uint32_t> indices{5, 3, 5, 199};
+  CHECK((Collect(indexed.Select(indices)) == std::vector<int>{5, 3, 5, 199}));
+
+  Passthrough passthrough;
+  passthrough.data_ = {1, 2, 3};
+  int order[] = {2, 0};
+  CHECK((Collect(passthrough.Select(order)) == std::vector<int>{3, 1}));
+}
+} // namespace
+
+int main() {
+  SelectsBitmasks();
+  SelectsIndices();
+  return Test::Result();
+}
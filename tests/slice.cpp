@@ -0,0 +1,74 @@
+// For::Slice and For::Window over passthrough and indexed containers
+#include <cstddef>
+#include <numeric>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Passthrough : Iterable::For<Passthrough> {
+  std::vector<int> data_;
+};
+
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+// Expects the elements 0 to 9
+template <typename C>
+void Slices(C &container) {
+  auto slice = container.Slice(2, 5);
+  CHECK(slice.size() == 3);
+  CHECK(slice[0] == 2);
+  CHECK(*(slice.end() - 1) == 4);
+  CHECK(std::accumulate(slice.begin(), slice.end(), 0) == 9);
+  *slice.begin() = 20;
+  CHECK(*(container.begin() + 2) == 20);
+  *slice.begin() = 2;
+  CHECK(container.Slice(3, 3).empty());
+  const C &constant = container;
+  CHECK(constant.Slice(0, 10).size() == 10);
+}
+
+template <typename C>
+void Windows(C &container) {
+  auto windows = container.Window(3);
+  CHECK(windows.size() == 8);
+  std::vector<int> sums;
+  for (auto window : windows) {
+    sums.push_back(std::accumulate(window.begin(), window.end(), 0));
+  }
+  CHECK(sums.size() == 8);
+  CHECK(sums.front() == 0 + 1 + 2);
+  CHECK(sums.back() == 7 + 8 + 9);
+  CHECK(container.Window(11).empty());
+  CHECK(container.Window(10).size() == 1);
+  const C &constant = container;
+  CHECK(constant.Window(1).size() == 10);
+}
+
+template <typename C>
+void Check(C &container) {
+  Slices(container);
+  Windows(container);
+}
+} // namespace
+
+int main() {
+  Passthrough passthrough;
+  passthrough.data_.resize(10);
+  std::iota(passthrough.data_.begin(), passthrough.data_.end(), 0);
+  Check(passthrough);
+  Indexed indexed;
+  indexed.values.resize(10);
+  std::iota(indexed.values.begin(), indexed.values.end(), 0);
+  Check(indexed);
+#if ITERABLE_CPP_20
+  static_assert(std::ranges::forward_range<decltype(indexed.Window(2))>);
+#endif
+  return Test::Result();
+}
@@ -0,0 +1,77 @@
+// AppendLog snapshots read concurrently with a single writer
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iterable/snapshot.h>
+#include "test.h"
+
+namespace {
+void ReadersSeePrefixes() {
+  constexpr std::size_t Length = 50000;
+  Iterable::AppendLog<std::size_t, 256> log(Length);
+  std::atomic<bool> started{false};
+  std::atomic<bool> consistent{true};
+  std::thread writer([&] {
+    while (!started) {
+    }
+    for (std::size_t value = 0; value < Length; value++) {
+      log.Append(value);
+    }
+  });
+  std::vector<std::thread> readers;
+  for (int reader = 0; reader < 3; reader++) {
+    readers.emplace_back([&] {
+      started = true;
+      std::size_t last = 0;
+      while (last < Length) {
+        std::size_t count = 0;
+        for (auto value : log.Snapshot()) {
+          consistent = consistent && value == count;
+          count++;
+        }
+        // Snapshots never shrink
+        consistent = consistent && count >= last;
+        last = count;
+        count = 0;
+        for (auto value : log) {
+          consistent = consistent && value == count;
+          count++;
+        }
+      }
+    });
+  }
+  writer.join();
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  CHECK(consistent);
+  CHECK(log.Length() == Length);
+}
+
+void CapacityAndElements() {
+  Iterable::AppendLog<std::string, 4> log(10);
+  CHECK(log.Capacity() == 12);
+  for (int value = 0; value < 9; value++) {
+    log.Append(std::to_string(value));
+  }
+  CHECK(log.Snapshot().size() == 9);
+  CHECK(log[8] == "8");
+  while (log.Length() < log.Capacity()) {
+    log.Append("");
+  }
+  CHECK_THROWS(log.Append("full"), std::length_error);
+  CHECK(log.Length() == 12);
+
+  Iterable::AppendLog<std::string, 4> empty(0);
+  CHECK(empty.Snapshot().empty());
+}
+} // namespace
+
+int main() {
+  ReadersSeePrefixes();
+  CapacityAndElements();
+  return Test::Result();
+}
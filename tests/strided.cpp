@@ -0,0 +1,98 @@
+// Tag::Strided iteration and native reverse iteration
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+/// One column of a row-major matrix
+struct Column : Iterable::For<Column, Iterable::Strided> {
+  std::vector<int> *matrix = nullptr;
+  std::size_t col = 0;
+  std::size_t cols = 1;
+
+  int &operator[](std::size_t index) { return (*matrix)[col + index]; }
+  const int &operator[](std::size_t index) const { return (*matrix)[col + index]; }
+  std::size_t Length() const { return matrix->size() / cols; }
+  std::size_t Stride() const { return cols; }
+};
+
+/// First lane of four interleaved lanes, with a constant stride
+struct Lane : Iterable::For<Lane, Iterable::Strided> {
+  int values[16];
+
+  int &operator[](int index) { return values[index]; }
+  const int &operator[](int index) const { return values[index]; }
+  int Length() const { return 4; }
+  static constexpr int Stride() { return 4; }
+};
+
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct Pointer : Iterable::For<Pointer, Iterable::Contiguous> {
+  std::vector<int> values{1, 2, 3};
+
+  int &operator[](std::size_t index) { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+  int *Data() { return values.data(); }
+  const int *Data() const { return values.data(); }
+};
+
+void StridedElements() {
+  std::vector<int> matrix(12);
+  std::iota(matrix.begin(), matrix.end(), 0);
+  Column column;
+  column.matrix = &matrix;
+  column.col = 1;
+  column.cols = 4;
+  CHECK((std::vector<int>(column.begin(), column.end()) == std::vector<int>{1, 5, 9}));
+  CHECK(column.end() - column.begin() == 3);
+  CHECK(column.begin()[2] == 9);
+  std::sort(column.rbegin(), column.rend());
+  CHECK(matrix[1] == 9 && matrix[5] == 5 && matrix[9] == 1);
+  CHECK(matrix[0] == 0 && matrix[2] == 2);
+
+  Lane lane;
+  std::iota(lane.values, lane.values + 16, 0);
+  int sum = 0;
+  for (int value : lane) {
+    sum += value;
+  }
+  CHECK(sum == 0 + 4 + 8 + 12);
+}
+
+void ReverseIteration() {
+  Indexed container;
+  container.values = {1, 2, 3, 4};
+  CHECK((std::vector<int>(container.rbegin(), container.rend()) == std::vector<int>{4, 3, 2, 1}));
+  const Indexed &view = container;
+  CHECK(*view.crbegin() == 4);
+  CHECK(view.rend() - view.rbegin() == 4 && view.rbegin() < view.rend());
+  CHECK(view.rbegin()[1] == 3 && *(view.rend() - 1) == 1);
+  CHECK(view.rbegin().Base() == view.end());
+  std::sort(container.rbegin(), container.rend());
+  CHECK((container.values == std::vector<int>{4, 3, 2, 1}));
+
+  Pointer pointer;
+  CHECK(*pointer.rbegin() == 3 && pointer.rend() - pointer.rbegin() == 3);
+#if ITERABLE_CPP_20
+  static_assert(std::random_access_iterator<decltype(container.rbegin())>);
+  static_assert(std::random_access_iterator<decltype(std::declval<Column &>().begin())>);
+#endif
+}
+} // namespace
+
+int main() {
+  StridedElements();
+  ReverseIteration();
+  return Test::Result();
+}
@@ -0,0 +1,52 @@
+/**
+ * @file
+ * @brief Checking macros shared by the tests.
+ *
+ * Every test is an executable whose `main()` runs its cases and returns
+ * `Test::Result()`; a failed check reports the expression and continues.
+ */
+#pragma once
+
+#include <cstdio>
+
+namespace Test {
+
+/// Number of failed checks so far
+inline int &Failures() noexcept {
+  static int failures = 0;
+  return failures;
+}
+
+/// Report a failed check
+inline void Fail(const char *expression, const char *file, int line) noexcept {
+  std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+  Failures()++;
+}
+
+/// Exit status of the test: non-zero if a check failed
+inline int Result() noexcept {
+  return Failures() == 0 ? 0 : 1;
+}
+
+/// Exit status telling CTest that the test was skipped
+inline constexpr int Skipped = 77;
+
+} // namespace Test
+
+/// Check that `condition` holds
+#define CHECK(condition) \
+  ((condition) ? static_cast<void>(0) : ::Test::Fail(#condition, __FILE__, __LINE__))
+
+/// Check that `statement` throws an exception of type `type`
+#define CHECK_THROWS(statement, type)                                \
+  do {                                                               \
+    bool thrown = false;                                             \
+    try {                                                            \
+      statement;                                                     \
+    } catch (const type &) {                                         \
+      thrown = true;                                                 \
+    }                                                                \
+    if (!thrown) {                                                   \
+      ::Test::Fail(#statement " throws " #type, __FILE__, __LINE__); \
+    }                                                                \
+  } while (false)
@@ -0,0 +1,86 @@
+// Lazy Map, Filter and Take views on For
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <iterable/iterable.h>
+#include "test.h"
+
+namespace {
+struct Indexed : Iterable::For<Indexed> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct Passthrough : Iterable::For<Passthrough> {
+  std::vector<std::string> data_{"a", "bb", "ccc"};
+};
+
+Indexed Sequence(int length) {
+  Indexed container;
+  for (int value = 0; value < length; value++) {
+    container.values.push_back(value);
+  }
+  return container;
+}
+
+void ViewsCompose() {
+  auto container = Sequence(20);
+  std::vector<int> out;
+  for (int value : container.Map([](int x) { return x * x; }).Filter([](int x) { return x % 2 == 0; }).Take(3)) {
+    out.push_back(value);
+  }
+  CHECK((out == std::vector<int>{0, 4, 16}));
+
+  int sum = 0;
+  for (int value : container.Take(2).Map([](int x) { return x + 1; })) {
+    sum += value;
+  }
+  CHECK(sum == 3);
+
+  Passthrough strings;
+  std::size_t length = 0;
+  for (auto size : strings.Map(&std::string::size)) {
+    length += size;
+  }
+  CHECK(length == 6);
+}
+
+void FilterYieldsReferences() {
+  auto container = Sequence(20);
+  for (int &value : container.Filter([](int x) { return x > 17; })) {
+    value = -1;
+  }
+  CHECK(container.values[17] == 17 && container.values[18] == -1 && container.values[19] == -1);
+}
+
+void TakeStopsAtTheEnd() {
+  const auto container = Sequence(20);
+  int count = 0;
+  for (auto value : container.Take(100)) {
+    count += value >= 0;
+  }
+  CHECK(count == 20);
+  count = 0;
+  for (auto value : container.Take(0)) {
+    count += value >= 0;
+  }
+  CHECK(count == 0);
+  auto filtered = container.Filter([](int) { return false; });
+  CHECK(filtered.begin() == filtered.end());
+#if ITERABLE_CPP_20
+  auto view = container.Map([](int x) { return x; });
+  static_assert(std::ranges::input_range<decltype(view)>);
+  static_assert(std::sentinel_for<Iterable::ViewEnd, decltype(view.begin())>);
+#endif
+}
+} // namespace
+
+int main() {
+  ViewsCompose();
+  FilterYieldsReferences();
+  TakeStopsAtTheEnd();
+  return Test::Result();
+}
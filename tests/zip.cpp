@@ -0,0 +1,75 @@
+// Joint iteration over several containers with Zip
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <iterable/zip.h>
+#include "test.h"
+
+namespace {
+struct Column : Iterable::For<Column> {
+  std::vector<int> values;
+
+  int &operator[](std::size_t index) { return values[index]; }
+  const int &operator[](std::size_t index) const { return values[index]; }
+  std::size_t Length() const { return values.size(); }
+};
+
+struct FloatColumn : Iterable::For<FloatColumn> {
+  std::vector<float> values;
+
+  float &operator[](int index) { return values[static_cast<std::size_t>(index)]; }
+  const float &operator[](int index) const { return values[static_cast<std::size_t>(index)]; }
+  int Length() const { return static_cast<int>(values.size()); }
+};
+
+void BindingsReferToElements() {
+  Column a;
+  a.values = {1, 2, 3};
+  FloatColumn b;
+  b.values = {1, 2, 3, 4};
+  const Column c = a;
+  int count = 0;
+  for (auto [x, y, z] : Iterable::Zip(a, b, c)) {
+    x += z;
+    y *= 2;
+    count++;
+  }
+  CHECK(count == 3);
+  CHECK((a.values == std::vector<int>{2, 4, 6}));
+  CHECK((b.values == std::vector<float>{2, 4, 6, 4}));
+  static_assert(std::is_same_v<decltype(std::get<2>(*Iterable::Zip(a, b, c).begin())), const int &>);
+}
+
+void ShortestLength() {
+  Column a;
+  a.values = {1, 2, 3, 4, 5};
+  FloatColumn b;
+  b.values = {1, 2};
+  auto zipped = Iterable::Zip(a, b);
+  CHECK(zipped.Length() == 2);
+  CHECK(zipped.end() - zipped.begin() == 2);
+  static_assert(std::is_same_v<decltype(zipped)::IndexType, std::common_type_t<std::size_t, int>>);
+  FloatColumn empty;
+  CHECK(Iterable::Zip(a, empty).begin() == Iterable::Zip(a, empty).end());
+}
+
+void WorksWithAlgorithms() {
+  Column a;
+  a.values = {5, 1, 4};
+  Column b;
+  b.values = {0, 1, 2};
+  auto zipped = Iterable::Zip(a, b);
+  CHECK(std::count_if(zipped.begin(), zipped.end(), [](auto row) { return std::get<0>(row) > std::get<1>(row); }) == 2);
+  auto found = std::find_if(zipped.begin(), zipped.end(), [](auto row) { return std::get<0>(row) == 4; });
+  CHECK(found - zipped.begin() == 2 && std::get<1>(*found) == 2);
+}
+} // namespace
+
+int main() {
+  BindingsReferToElements();
+  ShortestLength();
+  WorksWithAlgorithms();
+  return Test::Result();
+}